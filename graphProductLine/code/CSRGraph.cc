@@ -0,0 +1,370 @@
+/**
+ * @file CSRGraph.cc
+ *
+ * @author agent
+ * @date 2026-10-17
+ *
+ * @brief Defines the class CSRGraph, a frozen compressed sparse row copy
+ * of the graph used by the traversal algorithms
+ */
+
+#include "CSRGraph.h"
+#include "Parallel.h"
+#include "Stats.h"
+#include <algorithm>
+#include <atomic>
+
+using namespace std;
+
+/**
+ * @brief Construct a new CSRGraph:: CSRGraph object
+ *
+ */
+CSRGraph::CSRGraph() : nodeCount{0}, weighted{false}, directed{false}, negativeWeights{false} {
+    offsetStore.assign(1, 0);
+    attachStores();
+}
+
+/**
+ * @brief Destroy the CSRGraph:: CSRGraph object
+ *
+ */
+CSRGraph::~CSRGraph() {
+
+}
+
+/**
+ * @brief Points the public views at the arrays owned by this graph
+ *
+ */
+void CSRGraph::attachStores() {
+    offsets = offsetStore;
+    targets = targetStore;
+    weights = weightStore;
+    edgeIDs = edgeIDStore;
+    edgeStarts = edgeStartStore;
+    edgeEnds = edgeEndStore;
+    edgeWeights = edgeWeightStore;
+}
+
+/**
+ * @brief Adds the arrays of a build to the allocation counters
+ *
+ */
+void CSRGraph::countStores() {
+    for (const vector<int>* store : {&offsetStore, &targetStore, &weightStore, &edgeIDStore,
+        &edgeStartStore, &edgeEndStore, &edgeWeightStore}) {
+        if (store->capacity() > 0) {
+            STAT_ADD(allocations, 1);
+            STAT_ADD(allocatedBytes, store->capacity() * sizeof(int));
+        }
+    }
+}
+
+/**
+ * @brief Empties all arrays
+ *
+ */
+void CSRGraph::clear() {
+    nodeCount = 0;
+    negativeWeights = false;
+    offsetStore.assign(1, 0);
+    targetStore.clear();
+    weightStore.clear();
+    edgeIDStore.clear();
+    edgeStartStore.clear();
+    edgeEndStore.clear();
+    edgeWeightStore.clear();
+    attachStores();
+}
+
+/**
+ * @brief Uses arrays owned by someone else, such as a memory-mapped
+ * snapshot, without copying them. They must outlive this graph or the
+ * next build.
+ *
+ */
+void CSRGraph::attach(int nodeCount, bool weighted, bool directed, bool negativeWeights,
+    ArrayView<int> offsets, ArrayView<int> targets, ArrayView<int> weights, ArrayView<int> edgeIDs,
+    ArrayView<int> edgeStarts, ArrayView<int> edgeEnds, ArrayView<int> edgeWeights) {
+    clear();
+    this->nodeCount = nodeCount;
+    this->weighted = weighted;
+    this->directed = directed;
+    this->negativeWeights = negativeWeights;
+    this->offsets = offsets;
+    this->targets = targets;
+    this->weights = weights;
+    this->edgeIDs = edgeIDs;
+    this->edgeStarts = edgeStarts;
+    this->edgeEnds = edgeEnds;
+    this->edgeWeights = edgeWeights;
+}
+
+/**
+ * @brief Builds the adjacency arrays from an edge list with a counting sort.
+ * Undirected edges are stored in the rows of both endpoints. Within a row,
+ * neighbors keep the order of the edge list.
+ *
+ * @param nodeCount
+ * @param starts
+ * @param ends
+ * @param edgeWeights: empty for unweighted graphs
+ * @param weighted
+ * @param directed
+ */
+void CSRGraph::build(int nodeCount, ArrayView<int> starts, ArrayView<int> ends,
+    ArrayView<int> edgeWeights, bool weighted, bool directed) {
+    this->nodeCount = nodeCount;
+    this->weighted = weighted;
+    this->directed = directed;
+    this->negativeWeights = false;
+    edgeStartStore.assign(starts.begin(), starts.end());
+    edgeEndStore.assign(ends.begin(), ends.end());
+    edgeWeightStore.assign(edgeWeights.begin(), edgeWeights.end());
+
+    int edgeCount = (int)starts.size();
+    for (int w : edgeWeightStore) {
+        if (w < 0) {
+            negativeWeights = true;
+            break;
+        }
+    }
+
+    // Count the degree of every node
+    offsetStore.assign(nodeCount + 1, 0);
+    for (int e = 0; e < edgeCount; e++) {
+        offsetStore[edgeStartStore[e] + 1]++;
+        if (!directed) {
+            offsetStore[edgeEndStore[e] + 1]++;
+        }
+    }
+    for (int u = 0; u < nodeCount; u++) {
+        offsetStore[u + 1] += offsetStore[u];
+    }
+
+    // Scatter the edges into their rows
+    int slotCount = offsetStore[nodeCount];
+    targetStore.assign(slotCount, 0);
+    edgeIDStore.assign(slotCount, 0);
+    weightStore.assign(weighted ? slotCount : 0, 0);
+
+    vector<int> cursor(offsetStore.begin(), offsetStore.end() - 1);
+    for (int e = 0; e < edgeCount; e++) {
+        int slot = cursor[edgeStartStore[e]]++;
+        targetStore[slot] = edgeEndStore[e];
+        edgeIDStore[slot] = e;
+        if (weighted) {
+            weightStore[slot] = edgeWeightStore[e];
+        }
+
+        if (!directed) {
+            slot = cursor[edgeEndStore[e]]++;
+            targetStore[slot] = edgeStartStore[e];
+            edgeIDStore[slot] = e;
+            if (weighted) {
+                weightStore[slot] = edgeWeightStore[e];
+            }
+        }
+    }
+
+    countStores();
+    attachStores();
+}
+
+/**
+ * @brief Builds the same arrays as build() with a two-level parallel
+ * counting sort. Adjacency entries ("half edges": one per directed edge,
+ * two per undirected edge) are first partitioned into buckets of
+ * consecutive rows with per-block histograms, then every bucket is
+ * sorted into its rows by one thread. Both passes are stable, so rows
+ * keep the order of the edge list.
+ *
+ * @param nodeCount
+ * @param starts: moved into the graph
+ * @param ends: moved into the graph
+ * @param edgeWeights: moved into the graph, empty for unweighted graphs
+ * @param weighted
+ * @param directed
+ * @param threadCount
+ */
+void CSRGraph::buildParallel(int nodeCount, vector<int>&& starts, vector<int>&& ends,
+    vector<int>&& edgeWeights, bool weighted, bool directed, int threadCount) {
+    this->nodeCount = nodeCount;
+    this->weighted = weighted;
+    this->directed = directed;
+    edgeStartStore = move(starts);
+    edgeEndStore = move(ends);
+    edgeWeightStore = move(edgeWeights);
+
+    atomic<bool> negative(false);
+    int edgeCount = (int)edgeStartStore.size();
+    int blocks = max(1, min(threadCount * 4, edgeCount / 65536 + 1));
+    parallelFor(blocks, threadCount, [&](int b) {
+        size_t first = (size_t)edgeWeightStore.size() * b / blocks;
+        size_t last = (size_t)edgeWeightStore.size() * (b + 1) / blocks;
+        for (size_t e = first; e < last; e++) {
+            if (edgeWeightStore[e] < 0) {
+                negative = true;
+                break;
+            }
+        }
+    });
+    negativeWeights = negative;
+
+    // Half edge h belongs to edge h (directed) or h / 2 (undirected)
+    long long halfCount = directed ? edgeCount : 2LL * edgeCount;
+    auto rowOf = [&](long long h) {
+        return directed ? edgeStartStore[h] : ((h & 1) ? edgeEndStore[h >> 1] : edgeStartStore[h >> 1]);
+    };
+    auto targetOf = [&](long long h) {
+        return directed ? edgeEndStore[h] : ((h & 1) ? edgeStartStore[h >> 1] : edgeEndStore[h >> 1]);
+    };
+
+    int buckets = max(1, min(threadCount * 16, nodeCount));
+    int rowsPerBucket = nodeCount == 0 ? 1 : (nodeCount + buckets - 1) / buckets;
+
+    // Pass 1: stable partition of the half edges into row buckets
+    vector<long long> counts((size_t)blocks * buckets, 0);
+    parallelFor(blocks, threadCount, [&](int b) {
+        long long* count = &counts[(size_t)b * buckets];
+        for (long long h = halfCount * b / blocks; h < halfCount * (b + 1) / blocks; h++) {
+            count[rowOf(h) / rowsPerBucket]++;
+        }
+    });
+
+    vector<long long> bucketStart(buckets + 1, 0);
+    long long position = 0;
+    for (int k = 0; k < buckets; k++) {
+        bucketStart[k] = position;
+        for (int b = 0; b < blocks; b++) {
+            long long count = counts[(size_t)b * buckets + k];
+            counts[(size_t)b * buckets + k] = position;
+            position += count;
+        }
+    }
+    bucketStart[buckets] = position;
+
+    vector<long long> partitioned(halfCount);
+    parallelFor(blocks, threadCount, [&](int b) {
+        long long* cursor = &counts[(size_t)b * buckets];
+        for (long long h = halfCount * b / blocks; h < halfCount * (b + 1) / blocks; h++) {
+            partitioned[cursor[rowOf(h) / rowsPerBucket]++] = h;
+        }
+    });
+
+    // Pass 2: counting sort of every bucket into its rows
+    offsetStore.assign(nodeCount + 1, 0);
+    targetStore.resize(halfCount);
+    edgeIDStore.resize(halfCount);
+    weightStore.resize(weighted ? halfCount : 0);
+    offsetStore[nodeCount] = (int)halfCount;
+
+    parallelFor(buckets, threadCount, [&](int k) {
+        int firstRow = min(nodeCount, k * rowsPerBucket);
+        int lastRow = min(nodeCount, firstRow + rowsPerBucket);
+        if (firstRow >= lastRow) {
+            return;
+        }
+
+        vector<int> cursor(lastRow - firstRow, 0);
+        for (long long i = bucketStart[k]; i < bucketStart[k + 1]; i++) {
+            cursor[rowOf(partitioned[i]) - firstRow]++;
+        }
+        int slot = (int)bucketStart[k];
+        for (int u = firstRow; u < lastRow; u++) {
+            int degree = cursor[u - firstRow];
+            offsetStore[u] = slot;
+            cursor[u - firstRow] = slot;
+            slot += degree;
+        }
+
+        for (long long i = bucketStart[k]; i < bucketStart[k + 1]; i++) {
+            long long h = partitioned[i];
+            int e = (int)(directed ? h : h >> 1);
+            int target = cursor[rowOf(h) - firstRow]++;
+            targetStore[target] = targetOf(h);
+            edgeIDStore[target] = e;
+            if (weighted) {
+                weightStore[target] = edgeWeightStore[e];
+            }
+        }
+    });
+
+    countStores();
+    attachStores();
+}
+
+/**
+ * @brief Builds the graph with every edge reversed. The edge list of the
+ * transpose keeps the edge indices of the original graph.
+ *
+ * @param graph
+ */
+void CSRGraph::buildTranspose(const CSRGraph& graph) {
+    build(graph.getNodeCount(), graph.edgeEnds, graph.edgeStarts, graph.edgeWeights,
+        graph.isWeighted(), graph.isDirected());
+}
+
+/**
+ * @brief Freezes the mutable Node/Edge structures into CSR arrays.
+ * Neighbors keep the same order they have in the mutable structures.
+ *
+ * @param nodes
+ * @param edges
+ * @param weighted
+ * @param directed
+ */
+void CSRGraph::build(const vector<Node*>& nodes, const vector<vector<Edge*>>& edges,
+    bool weighted, bool directed) {
+    if (weighted) {
+        // Every edge is listed once in the row of its start node (twice for
+        // undirected self-loops). Edge IDs give back the insertion order.
+        vector<Edge*> unique;
+        for (int u = 0; u < (int)edges.size(); u++) {
+            const vector<Edge*>& row = edges[u];
+            for (size_t i = 0; i < row.size(); i++) {
+                Edge* edge = row[i];
+                if (edge->getStartNodeID() != u) continue;
+                if (!directed && i > 0 && row[i - 1] == edge) continue;
+                unique.push_back(edge);
+            }
+        }
+        sort(unique.begin(), unique.end(), [](Edge* a, Edge* b) {
+            return a->getID() < b->getID();
+        });
+
+        vector<int> starts, ends, edgeWeights;
+        for (Edge* edge : unique) {
+            starts.push_back(edge->getStartNodeID());
+            ends.push_back(edge->getEndNodeID());
+            edgeWeights.push_back(edge->getWeight());
+        }
+        build((int)nodes.size(), starts, ends, edgeWeights, true, directed);
+        return;
+    }
+
+    // Unweighted graphs keep their rows as they are. The edge list lists
+    // undirected edges once, from their lower endpoint.
+    clear();
+    this->nodeCount = (int)nodes.size();
+    this->weighted = false;
+    this->directed = directed;
+    offsetStore.assign(nodeCount + 1, 0);
+
+    for (int u = 0; u < nodeCount; u++) {
+        const vector<int>& neighbors = nodes[u]->neighbors;
+        bool skipLoop = false;
+        for (int v : neighbors) {
+            targetStore.push_back(v);
+            if (directed || u < v || (u == v && (skipLoop = !skipLoop))) {
+                edgeStartStore.push_back(u);
+                edgeEndStore.push_back(v);
+            }
+        }
+        offsetStore[u + 1] = (int)targetStore.size();
+    }
+
+    countStores();
+    attachStores();
+}
@@ -0,0 +1,94 @@
+/**
+ * @file CSRGraph.h
+ *
+ * @author agent
+ * @date 2026-10-17
+ *
+ * @brief Defines the class CSRGraph, a frozen compressed sparse row copy
+ * of the graph used by the traversal algorithms
+ */
+
+#ifndef GRAPH_APP_CSRGRAPH_H
+#define GRAPH_APP_CSRGRAPH_H
+
+#include "Node.h"
+#include "Edge.h"
+#include <cstddef>
+#include <vector>
+
+/**
+ * Read-only view of a contiguous array, either owned by a CSRGraph or
+ * mapped from a snapshot file
+ */
+template <class T>
+class ArrayView {
+	public:
+	ArrayView() : ptr{nullptr}, count{0} {};
+	ArrayView(const T* ptr, size_t count) : ptr{ptr}, count{count} {};
+	ArrayView(const std::vector<T>& vect) : ptr{vect.data()}, count{vect.size()} {};
+
+	const T& operator[](size_t i) const { return ptr[i]; };
+	const T* data() const { return ptr; };
+	size_t size() const { return count; };
+	bool empty() const { return count == 0; };
+	const T* begin() const { return ptr; };
+	const T* end() const { return ptr + count; };
+
+	private:
+	const T* ptr;
+	size_t count;
+};
+
+class CSRGraph {
+	public:
+	/**	Constructors/Destructors */
+	CSRGraph();
+	CSRGraph(const CSRGraph&) = delete;
+	CSRGraph& operator=(const CSRGraph&) = delete;
+	~CSRGraph();
+
+	/** Building methods */
+	void build(int nodeCount, ArrayView<int> starts, ArrayView<int> ends,
+		ArrayView<int> edgeWeights, bool weighted, bool directed);
+	void build(const std::vector<Node*>& nodes, const std::vector<std::vector<Edge*>>& edges,
+		bool weighted, bool directed);
+	void buildParallel(int nodeCount, std::vector<int>&& starts, std::vector<int>&& ends,
+		std::vector<int>&& edgeWeights, bool weighted, bool directed, int threadCount);
+	void buildTranspose(const CSRGraph& graph);
+	void attach(int nodeCount, bool weighted, bool directed, bool negativeWeights,
+		ArrayView<int> offsets, ArrayView<int> targets, ArrayView<int> weights, ArrayView<int> edgeIDs,
+		ArrayView<int> edgeStarts, ArrayView<int> edgeEnds, ArrayView<int> edgeWeights);
+	void clear();
+
+	/** Accessor methods */
+	int getNodeCount() const { return nodeCount; };
+	int getEdgeCount() const { return (int)edgeStarts.size(); };
+	int degree(int nodeID) const { return offsets[nodeID + 1] - offsets[nodeID]; };
+	bool isWeighted() const { return weighted; };
+	bool isDirected() const { return directed; };
+	bool hasNegativeWeights() const { return negativeWeights; };
+
+	/** Adjacency arrays: the neighbors of node u are targets[offsets[u]..offsets[u+1]) */
+	ArrayView<int> offsets;
+	ArrayView<int> targets;
+	ArrayView<int> weights;
+	ArrayView<int> edgeIDs;
+
+	/** Edge list: edgeIDs index these arrays */
+	ArrayView<int> edgeStarts;
+	ArrayView<int> edgeEnds;
+	ArrayView<int> edgeWeights;
+
+	private:
+	int nodeCount;
+	bool weighted, directed, negativeWeights;
+
+	/** Storage behind the views when the graph was built in memory */
+	std::vector<int> offsetStore, targetStore, weightStore, edgeIDStore;
+	std::vector<int> edgeStartStore, edgeEndStore, edgeWeightStore;
+
+	void attachStores();
+	void countStores();
+};
+
+#endif //GRAPH_APP_CSRGRAPH_H
@@ -0,0 +1,83 @@
+/**
+ * @file CaptureBuffer.cc
+ *
+ * @author agent
+ * @date 2026-10-17
+ *
+ * @brief Defines the class CaptureBuffer, a stream buffer that passes
+ * output on to another stream buffer and keeps a copy of it up to a size
+ * limit
+ */
+
+#include "CaptureBuffer.h"
+
+using namespace std;
+
+/**
+ * @brief Construct a new CaptureBuffer:: CaptureBuffer object
+ *
+ * @param target: stream buffer the output is passed on to
+ * @param limit: most bytes kept; longer output is not kept at all
+ */
+CaptureBuffer::CaptureBuffer(streambuf* target, size_t limit) : target{target}, limit{limit}, capturing{true},
+    buffer(1 << 14) {
+    setp(buffer.data(), buffer.data() + buffer.size());
+}
+
+/**
+ * @brief Destroy the CaptureBuffer:: CaptureBuffer object, passing on
+ * what is left in the buffer
+ *
+ */
+CaptureBuffer::~CaptureBuffer() {
+    writeBuffer();
+}
+
+/**
+ * @brief Passes the buffered bytes on and copies them, dropping the copy
+ * once it would exceed the limit
+ *
+ * @return true
+ * @return false if the target failed to take the bytes
+ */
+bool CaptureBuffer::writeBuffer() {
+    streamsize count = pptr() - pbase();
+    bool written = target->sputn(pbase(), count) == count;
+
+    if (capturing) {
+        if (text.size() + count > limit) {
+            capturing = false;
+            string().swap(text);
+        } else {
+            text.append(pbase(), count);
+        }
+    }
+    setp(buffer.data(), buffer.data() + buffer.size());
+    return written;
+}
+
+/**
+ * @brief Called when the buffer is full: passes it on and stores c
+ *
+ * @param c
+ * @return int
+ */
+int CaptureBuffer::overflow(int c) {
+    if (!writeBuffer()) {
+        return traits_type::eof();
+    }
+    if (c != traits_type::eof()) {
+        *pptr() = (char)c;
+        pbump(1);
+    }
+    return traits_type::not_eof(c);
+}
+
+/**
+ * @brief Called on flush: passes the buffer on and flushes the target
+ *
+ * @return int
+ */
+int CaptureBuffer::sync() {
+    return writeBuffer() && target->pubsync() == 0 ? 0 : -1;
+}
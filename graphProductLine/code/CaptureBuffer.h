@@ -0,0 +1,47 @@
+/**
+ * @file CaptureBuffer.h
+ *
+ * @author agent
+ * @date 2026-10-17
+ *
+ * @brief Defines the class CaptureBuffer, a stream buffer that passes
+ * output on to another stream buffer and keeps a copy of it up to a size
+ * limit
+ */
+
+#ifndef GRAPH_APP_CAPTUREBUFFER_H
+#define GRAPH_APP_CAPTUREBUFFER_H
+
+#include <cstddef>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+class CaptureBuffer : public std::streambuf {
+	public:
+	/**	Constructors/Destructors */
+	CaptureBuffer(std::streambuf* target, size_t limit);
+	CaptureBuffer(const CaptureBuffer&) = delete;
+	CaptureBuffer& operator=(const CaptureBuffer&) = delete;
+	~CaptureBuffer();
+
+	/** Accessor methods */
+	bool isComplete() const { return capturing; };
+	std::string takeText() { return std::move(text); };
+
+	protected:
+	/** std::streambuf overrides */
+	int overflow(int c) override;
+	int sync() override;
+
+	private:
+	std::streambuf* target;
+	size_t limit;
+	bool capturing;		// false once the output outgrew the limit
+	std::string text;
+	std::vector<char> buffer;
+
+	bool writeBuffer();
+};
+
+#endif //GRAPH_APP_CAPTUREBUFFER_H
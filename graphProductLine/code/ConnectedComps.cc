@@ -0,0 +1,195 @@
+/**
+ * @file ConnectedComps.cc
+ *
+ * @author agent
+ * @date 2026-10-17
+ *
+ * @brief Defines the class ConnectedComps, which labels the connected
+ * components of an undirected graph in parallel with the Afforest
+ * algorithm
+ */
+
+#include "ConnectedComps.h"
+#include "Parallel.h"
+#include <algorithm>
+#include <random>
+#include <unordered_map>
+
+using namespace std;
+
+/** Nodes per parallel task */
+static const int BLOCK_SIZE = 4096;
+
+/** Nodes sampled to guess the largest component */
+static const int SAMPLE_SIZE = 1024;
+
+/**
+ * @brief Construct a new ConnectedComps:: ConnectedComps object
+ *
+ */
+ConnectedComps::ConnectedComps() : componentCount{0} {
+
+}
+
+/**
+ * @brief Destroy the ConnectedComps:: ConnectedComps object
+ *
+ */
+ConnectedComps::~ConnectedComps() {
+
+}
+
+/**
+ * @brief Merges the trees of u and v by hooking the larger root under the
+ * smaller one with a compare-and-swap, retrying if another thread moved
+ * either root first
+ *
+ * @param u
+ * @param v
+ */
+void ConnectedComps::link(int u, int v) {
+    int p1 = parent[u].load(memory_order_relaxed);
+    int p2 = parent[v].load(memory_order_relaxed);
+    while (p1 != p2) {
+        int high = max(p1, p2);
+        int low = min(p1, p2);
+        int highParent = parent[high].load(memory_order_relaxed);
+        if (highParent == low) {
+            break;
+        }
+        if (highParent == high && parent[high].compare_exchange_strong(highParent, low)) {
+            break;
+        }
+        p1 = parent[parent[high].load(memory_order_relaxed)].load(memory_order_relaxed);
+        p2 = parent[low].load(memory_order_relaxed);
+    }
+}
+
+/**
+ * @brief Points every node straight at its root (pointer jumping)
+ *
+ * @param nodeCount
+ * @param threadCount
+ */
+void ConnectedComps::compress(int nodeCount, int threadCount) {
+    int blocks = (nodeCount + BLOCK_SIZE - 1) / BLOCK_SIZE;
+    parallelFor(blocks, threadCount, [&](int b) {
+        int last = min(nodeCount, (b + 1) * BLOCK_SIZE);
+        for (int v = b * BLOCK_SIZE; v < last; v++) {
+            int p = parent[v].load(memory_order_relaxed);
+            int grandparent;
+            while (p != (grandparent = parent[p].load(memory_order_relaxed))) {
+                parent[v].store(grandparent, memory_order_relaxed);
+                p = grandparent;
+            }
+        }
+    });
+}
+
+/**
+ * @brief Returns the most common root among a random sample of nodes,
+ * which after the first rounds is very likely the largest component
+ *
+ * @param nodeCount
+ * @return int
+ */
+int ConnectedComps::sampleFrequentRoot(int nodeCount) {
+    mt19937 rng(27491095);
+    uniform_int_distribution<int> pick(0, nodeCount - 1);
+    unordered_map<int, int> counts;
+    for (int i = 0; i < SAMPLE_SIZE; i++) {
+        counts[parent[pick(rng)].load(memory_order_relaxed)]++;
+    }
+
+    auto best = max_element(counts.begin(), counts.end(),
+        [](const pair<const int, int>& a, const pair<const int, int>& b) { return a.second < b.second; });
+    return best->first;
+}
+
+/**
+ * @brief Labels the components with Afforest (Sutton et al.): the first
+ * NEIGHBOR_ROUNDS neighbors of every node are linked, the largest
+ * component is guessed from a sample, and the remaining edges are only
+ * linked for nodes outside of it. Every phase runs in parallel over
+ * blocks of nodes. The graph must be undirected.
+ *
+ * @param graph
+ * @param threadCount
+ * @return int
+ */
+int ConnectedComps::compute(const CSRGraph& graph, int threadCount) {
+    int nodeCount = graph.getNodeCount();
+    int blocks = (nodeCount + BLOCK_SIZE - 1) / BLOCK_SIZE;
+    parent = vector<atomic<int>>(nodeCount);
+    parallelFor(blocks, threadCount, [&](int b) {
+        int last = min(nodeCount, (b + 1) * BLOCK_SIZE);
+        for (int v = b * BLOCK_SIZE; v < last; v++) {
+            parent[v].store(v, memory_order_relaxed);
+        }
+    });
+
+    for (int round = 0; round < NEIGHBOR_ROUNDS; round++) {
+        parallelFor(blocks, threadCount, [&](int b) {
+            int last = min(nodeCount, (b + 1) * BLOCK_SIZE);
+            for (int u = b * BLOCK_SIZE; u < last; u++) {
+                if (round < graph.degree(u)) {
+                    link(u, graph.targets[graph.offsets[u] + round]);
+                }
+            }
+        });
+        compress(nodeCount, threadCount);
+    }
+
+    int frequent = nodeCount > 0 ? sampleFrequentRoot(nodeCount) : 0;
+    parallelFor(blocks, threadCount, [&](int b) {
+        int last = min(nodeCount, (b + 1) * BLOCK_SIZE);
+        for (int u = b * BLOCK_SIZE; u < last; u++) {
+            if (parent[u].load(memory_order_relaxed) == frequent) {
+                continue;
+            }
+            for (int slot = graph.offsets[u] + NEIGHBOR_ROUNDS; slot < graph.offsets[u + 1]; slot++) {
+                link(u, graph.targets[slot]);
+            }
+        }
+    });
+    compress(nodeCount, threadCount);
+
+    // Number the roots in node order, then label every node by its root
+    vector<int> rootsBefore(blocks + 1, 0);
+    parallelFor(blocks, threadCount, [&](int b) {
+        int last = min(nodeCount, (b + 1) * BLOCK_SIZE);
+        for (int v = b * BLOCK_SIZE; v < last; v++) {
+            rootsBefore[b + 1] += parent[v].load(memory_order_relaxed) == v;
+        }
+    });
+    for (int b = 0; b < blocks; b++) {
+        rootsBefore[b + 1] += rootsBefore[b];
+    }
+    componentCount = rootsBefore[blocks];
+
+    labels.resize(nodeCount);
+    parallelFor(blocks, threadCount, [&](int b) {
+        int next = rootsBefore[b];
+        int last = min(nodeCount, (b + 1) * BLOCK_SIZE);
+        for (int v = b * BLOCK_SIZE; v < last; v++) {
+            if (parent[v].load(memory_order_relaxed) == v) {
+                labels[v] = next++;
+            }
+        }
+    });
+    parallelFor(blocks, threadCount, [&](int b) {
+        int last = min(nodeCount, (b + 1) * BLOCK_SIZE);
+        for (int v = b * BLOCK_SIZE; v < last; v++) {
+            int root = parent[v].load(memory_order_relaxed);
+            if (root != v) {
+                labels[v] = labels[root];
+            }
+        }
+    });
+
+    sizes.assign(componentCount, 0);
+    for (int label : labels) {
+        sizes[label]++;
+    }
+    return componentCount;
+}
@@ -0,0 +1,49 @@
+/**
+ * @file ConnectedComps.h
+ *
+ * @author agent
+ * @date 2026-10-17
+ *
+ * @brief Defines the class ConnectedComps, which labels the connected
+ * components of an undirected graph in parallel with the Afforest
+ * algorithm
+ */
+
+#ifndef GRAPH_APP_CONNECTEDCOMPS_H
+#define GRAPH_APP_CONNECTEDCOMPS_H
+
+#include "CSRGraph.h"
+#include <atomic>
+#include <vector>
+
+class ConnectedComps {
+	public:
+	/**	Constructors/Destructors */
+	ConnectedComps();
+	~ConnectedComps();
+
+	/** Computes the components, returning how many there are */
+	int compute(const CSRGraph& graph, int threadCount);
+
+	/** Accessor methods for the result of the last computation. Components
+	 *  are numbered in the order of their smallest node ID. */
+	int getComponentCount() const { return componentCount; };
+	const std::vector<int>& getComponents() const { return labels; };
+	const std::vector<int>& getSizes() const { return sizes; };
+
+	/** Neighbors of every node linked before the largest component is guessed */
+	static constexpr int NEIGHBOR_ROUNDS = 2;
+
+	private:
+	/** Parent pointers of the union-find forest; roots are the smallest node of their tree */
+	std::vector<std::atomic<int>> parent;
+	std::vector<int> labels;
+	std::vector<int> sizes;
+	int componentCount;
+
+	void link(int u, int v);
+	void compress(int nodeCount, int threadCount);
+	int sampleFrequentRoot(int nodeCount);
+};
+
+#endif //GRAPH_APP_CONNECTEDCOMPS_H
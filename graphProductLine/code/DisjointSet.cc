@@ -0,0 +1,109 @@
+/**
+ * @file DisjointSet.cc
+ *
+ * @author agent
+ * @date 2026-10-17
+ *
+ * @brief Defines the class DisjointSet, a union-find structure over node
+ * IDs with path compression and union by rank
+ */
+
+#include "DisjointSet.h"
+
+using namespace std;
+
+/**
+ * @brief Construct a new DisjointSet:: DisjointSet object
+ *
+ */
+DisjointSet::DisjointSet() : setCount{0} {
+
+}
+
+/**
+ * @brief Construct a new DisjointSet:: DisjointSet object with one
+ * singleton set per element
+ *
+ * @param elementCount
+ */
+DisjointSet::DisjointSet(int elementCount) {
+    reset(elementCount);
+}
+
+/**
+ * @brief Destroy the DisjointSet:: DisjointSet object
+ *
+ */
+DisjointSet::~DisjointSet() {
+
+}
+
+/**
+ * @brief Puts every element back in its own set
+ *
+ * @param elementCount
+ */
+void DisjointSet::reset(int elementCount) {
+    parent.resize(elementCount);
+    for (int i = 0; i < elementCount; i++) {
+        parent[i] = i;
+    }
+    rank.assign(elementCount, 0);
+    setCount = elementCount;
+}
+
+/**
+ * @brief Adds a new singleton set and returns its element
+ *
+ * @return int
+ */
+int DisjointSet::addElement() {
+    int id = (int)parent.size();
+    parent.push_back(id);
+    rank.push_back(0);
+    setCount++;
+    return id;
+}
+
+/**
+ * @brief Returns the representative of the set holding the element,
+ * halving the path on the way up
+ *
+ * @param id
+ * @return int
+ */
+int DisjointSet::find(int id) {
+    while (parent[id] != id) {
+        parent[id] = parent[parent[id]];
+        id = parent[id];
+    }
+    return id;
+}
+
+/**
+ * @brief Merges the sets holding a and b. Returns false if they were
+ * already in the same set.
+ *
+ * @param a
+ * @param b
+ * @return true
+ * @return false
+ */
+bool DisjointSet::unite(int a, int b) {
+    a = find(a);
+    b = find(b);
+    if (a == b) {
+        return false;
+    }
+
+    if (rank[a] < rank[b]) {
+        parent[a] = b;
+    } else if (rank[a] > rank[b]) {
+        parent[b] = a;
+    } else {
+        parent[b] = a;
+        rank[a]++;
+    }
+    setCount--;
+    return true;
+}
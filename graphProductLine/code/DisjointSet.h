@@ -0,0 +1,41 @@
+/**
+ * @file DisjointSet.h
+ *
+ * @author agent
+ * @date 2026-10-17
+ *
+ * @brief Defines the class DisjointSet, a union-find structure over node
+ * IDs with path compression and union by rank
+ */
+
+#ifndef GRAPH_APP_DISJOINTSET_H
+#define GRAPH_APP_DISJOINTSET_H
+
+#include <cstdint>
+#include <vector>
+
+class DisjointSet {
+	public:
+	/**	Constructors/Destructors */
+	DisjointSet();
+	DisjointSet(int elementCount);
+	~DisjointSet();
+
+	/** Accessor methods */
+	int find(int id);
+	bool connected(int a, int b) { return find(a) == find(b); };
+	int getSetCount() const { return setCount; };
+	int size() const { return (int)parent.size(); };
+
+	/** Mutator methods */
+	bool unite(int a, int b);
+	int addElement();
+	void reset(int elementCount);
+
+	private:
+	std::vector<int> parent;
+	std::vector<uint8_t> rank;
+	int setCount;
+};
+
+#endif //GRAPH_APP_DISJOINTSET_H
@@ -0,0 +1,316 @@
+/**
+ * @file DynamicMST.cc
+ *
+ * @author agent
+ * @date 2026-10-17
+ *
+ * @brief Defines the class DynamicMST, a minimum spanning forest that is
+ * repaired as edges are added or their weights change
+ */
+
+#include "DynamicMST.h"
+#include "Stats.h"
+
+using namespace std;
+
+/**
+ * @brief Construct a new DynamicMST:: DynamicMST object
+ *
+ */
+DynamicMST::DynamicMST() : edgeCount{0}, totalWeight{0}, epoch{0} {
+
+}
+
+/**
+ * @brief Destroy the DynamicMST:: DynamicMST object
+ *
+ */
+DynamicMST::~DynamicMST() {
+
+}
+
+/**
+ * @brief Releases the forest
+ *
+ */
+void DynamicMST::clear() {
+    edges.clear();
+    freeSlots.clear();
+    edgeCount = 0;
+    totalWeight = 0;
+    parent.clear();
+    parentSlot.clear();
+    adjacency.clear();
+    marks.clear();
+    epoch = 0;
+}
+
+/**
+ * @brief Stores a minimum spanning forest and roots every tree. The edges
+ * keep their order, which is the order they are listed in.
+ *
+ * @param nodeCount
+ * @param treeEdges
+ */
+void DynamicMST::build(int nodeCount, const vector<TreeEdge>& treeEdges) {
+    clear();
+    edges = treeEdges;
+    edgeCount = (int)edges.size();
+    parent.assign(nodeCount, -1);
+    parentSlot.assign(nodeCount, -1);
+    adjacency.resize(nodeCount);
+    marks.assign(nodeCount, 0);
+
+    for (int slot = 0; slot < edgeCount; slot++) {
+        adjacency[edges[slot].startNodeID].emplace_back(edges[slot].endNodeID, slot);
+        adjacency[edges[slot].endNodeID].emplace_back(edges[slot].startNodeID, slot);
+        totalWeight += edges[slot].weight;
+    }
+
+    // Root every tree at its first node
+    epoch = 1;
+    for (int root = 0; root < nodeCount; root++) {
+        if (marks[root] == epoch) {
+            continue;
+        }
+        marks[root] = epoch;
+        queue.assign(1, root);
+        for (size_t head = 0; head < queue.size(); head++) {
+            int u = queue[head];
+            for (auto& neighbor : adjacency[u]) {
+                if (marks[neighbor.first] != epoch) {
+                    marks[neighbor.first] = epoch;
+                    parent[neighbor.first] = u;
+                    parentSlot[neighbor.first] = neighbor.second;
+                    queue.push_back(neighbor.first);
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Adds a node that is a tree of its own
+ *
+ * @return int: the new node
+ */
+int DynamicMST::addNode() {
+    parent.push_back(-1);
+    parentSlot.push_back(-1);
+    adjacency.emplace_back();
+    marks.push_back(0);
+    return (int)parent.size() - 1;
+}
+
+/**
+ * @brief Returns the slot of the tree edge from startNodeID to endNodeID,
+ * in that orientation, or -1
+ *
+ * @param startNodeID
+ * @param endNodeID
+ * @return int
+ */
+int DynamicMST::findEdge(int startNodeID, int endNodeID) const {
+    for (auto& neighbor : adjacency[startNodeID]) {
+        const TreeEdge& edge = edges[neighbor.second];
+        if (edge.startNodeID == startNodeID && edge.endNodeID == endNodeID) {
+            return neighbor.second;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief Makes a node the root of its tree by reversing the parent links
+ * on its path to the old root
+ *
+ * @param nodeID
+ */
+void DynamicMST::reroot(int nodeID) {
+    int previous = -1, previousSlot = -1;
+    while (nodeID != -1) {
+        int next = parent[nodeID], nextSlot = parentSlot[nodeID];
+        parent[nodeID] = previous;
+        parentSlot[nodeID] = previousSlot;
+        previous = nodeID;
+        previousSlot = nextSlot;
+        nodeID = next;
+    }
+}
+
+/**
+ * @brief Returns the slot of the heaviest edge on the tree path between
+ * two nodes, or -1 if they are in different trees. Costs the depth of
+ * both nodes.
+ *
+ * @param startNodeID
+ * @param endNodeID
+ * @return int
+ */
+int DynamicMST::maxEdgeOnPath(int startNodeID, int endNodeID) {
+    epoch++;
+    for (int u = startNodeID; u != -1; u = parent[u]) {
+        marks[u] = epoch;
+        STAT_ADD(nodesVisited, 1);
+    }
+
+    int ancestor = endNodeID;
+    while (ancestor != -1 && marks[ancestor] != epoch) {
+        ancestor = parent[ancestor];
+        STAT_ADD(nodesVisited, 1);
+    }
+    if (ancestor == -1) {
+        return -1;
+    }
+
+    int maxSlot = -1;
+    for (int end : {startNodeID, endNodeID}) {
+        for (int u = end; u != ancestor; u = parent[u]) {
+            if (maxSlot == -1 || edges[parentSlot[u]].weight > edges[maxSlot].weight) {
+                maxSlot = parentSlot[u];
+            }
+        }
+    }
+    return maxSlot;
+}
+
+/**
+ * @brief Joins two trees with an edge
+ *
+ * @param startNodeID
+ * @param endNodeID
+ * @param weight
+ */
+void DynamicMST::link(int startNodeID, int endNodeID, int weight) {
+    int slot;
+    if (freeSlots.empty()) {
+        slot = (int)edges.size();
+        edges.push_back(TreeEdge{startNodeID, endNodeID, weight});
+    } else {
+        slot = freeSlots.back();
+        freeSlots.pop_back();
+        edges[slot] = TreeEdge{startNodeID, endNodeID, weight};
+    }
+    edgeCount++;
+    totalWeight += weight;
+
+    adjacency[startNodeID].emplace_back(endNodeID, slot);
+    adjacency[endNodeID].emplace_back(startNodeID, slot);
+    reroot(startNodeID);
+    parent[startNodeID] = endNodeID;
+    parentSlot[startNodeID] = slot;
+}
+
+/**
+ * @brief Removes a tree edge, splitting its tree in two. The slot is
+ * reused by the next link.
+ *
+ * @param slot
+ */
+void DynamicMST::unlink(int slot) {
+    int a = edges[slot].startNodeID, b = edges[slot].endNodeID;
+    int child = (parentSlot[a] == slot) ? a : b;
+    parent[child] = -1;
+    parentSlot[child] = -1;
+
+    for (int u : {a, b}) {
+        vector<pair<int, int>>& neighbors = adjacency[u];
+        for (size_t i = 0; i < neighbors.size(); i++) {
+            if (neighbors[i].second == slot) {
+                neighbors[i] = neighbors.back();
+                neighbors.pop_back();
+                break;
+            }
+        }
+    }
+
+    totalWeight -= edges[slot].weight;
+    edges[slot] = TreeEdge{-1, -1, 0};
+    freeSlots.push_back(slot);
+    edgeCount--;
+}
+
+/**
+ * @brief Adds a graph edge: it joins two trees, or replaces the heaviest
+ * edge of the cycle it closes if it is lighter
+ *
+ * @param startNodeID
+ * @param endNodeID
+ * @param weight
+ * @return true if the forest changed
+ */
+bool DynamicMST::insertEdge(int startNodeID, int endNodeID, int weight) {
+    if (startNodeID == endNodeID) {
+        return false;
+    }
+
+    int maxSlot = maxEdgeOnPath(startNodeID, endNodeID);
+    if (maxSlot != -1) {
+        if (edges[maxSlot].weight <= weight) {
+            return false;
+        }
+        unlink(maxSlot);
+    }
+    link(startNodeID, endNodeID, weight);
+    return true;
+}
+
+/**
+ * @brief Removes a tree edge, splitting its tree in two, and lists the
+ * nodes of the smaller part. The two parts are searched in turns, so
+ * the cost is the size of the smaller part. inSide() tells whether a
+ * node is in the listed part until the forest is searched again.
+ *
+ * @param slot
+ * @param side: receives the nodes of the smaller part
+ * @return int: the endpoint of the removed edge in the smaller part
+ */
+int DynamicMST::cut(int slot, vector<int>& side) {
+    int a = edges[slot].startNodeID, b = edges[slot].endNodeID;
+    unlink(slot);
+
+    int stampA = ++epoch, stampB = ++epoch;
+    marks[a] = stampA;
+    marks[b] = stampB;
+    queue.assign(1, a);
+    otherQueue.assign(1, b);
+    size_t heads[2] = {0, 0};
+    vector<int>* parts[2] = {&queue, &otherQueue};
+    int stamps[2] = {stampA, stampB};
+    int done = 0;
+    while (true) {
+        vector<int>& nodes = *parts[done];
+        if (heads[done] == nodes.size()) {
+            break;
+        }
+        int u = nodes[heads[done]++];
+        STAT_ADD(nodesVisited, 1);
+        for (auto& neighbor : adjacency[u]) {
+            if (marks[neighbor.first] != stamps[done]) {
+                marks[neighbor.first] = stamps[done];
+                nodes.push_back(neighbor.first);
+            }
+        }
+        done = 1 - done;
+    }
+
+    bool sideA = done == 0;
+    side.swap(sideA ? queue : otherQueue);
+    epoch++;
+    for (int u : side) {
+        marks[u] = epoch;
+    }
+    return sideA ? a : b;
+}
+
+/**
+ * @brief Changes the weight of a tree edge without checking that the
+ * forest stays minimal
+ *
+ * @param slot
+ * @param weight
+ */
+void DynamicMST::setWeight(int slot, int weight) {
+    totalWeight += (long long)weight - edges[slot].weight;
+    edges[slot].weight = weight;
+}
@@ -0,0 +1,74 @@
+/**
+ * @file DynamicMST.h
+ *
+ * @author agent
+ * @date 2026-10-17
+ *
+ * @brief Defines the class DynamicMST, a minimum spanning forest that is
+ * repaired as edges are added or their weights change
+ */
+
+#ifndef GRAPH_APP_DYNAMICMST_H
+#define GRAPH_APP_DYNAMICMST_H
+
+#include <utility>
+#include <vector>
+
+/**
+ * Edge of the spanning forest, with the orientation of the graph edge
+ */
+struct TreeEdge {
+	int startNodeID;
+	int endNodeID;
+	int weight;
+};
+
+class DynamicMST {
+	public:
+	/**	Constructors/Destructors */
+	DynamicMST();
+	~DynamicMST();
+
+	/** Building methods */
+	void build(int nodeCount, const std::vector<TreeEdge>& treeEdges);
+	void clear();
+
+	/** Editing methods */
+	int addNode();
+	bool insertEdge(int startNodeID, int endNodeID, int weight);
+	void link(int startNodeID, int endNodeID, int weight);
+	int cut(int slot, std::vector<int>& side);
+	void setWeight(int slot, int weight);
+
+	/** Accessor methods */
+	int findEdge(int startNodeID, int endNodeID) const;
+	bool inSide(int nodeID) const { return marks[nodeID] == epoch; };
+	const TreeEdge& edge(int slot) const { return edges[slot]; };
+	const std::vector<TreeEdge>& getEdges() const { return edges; };
+	bool isFree(int slot) const { return edges[slot].startNodeID == -1; };
+	long long getTotalWeight() const { return totalWeight; };
+	int getTreeCount() const { return (int)parent.size() - edgeCount; };
+
+	private:
+	/** Tree edges by slot; freed slots are reused so the listing stays stable */
+	std::vector<TreeEdge> edges;
+	std::vector<int> freeSlots;
+	int edgeCount;
+	long long totalWeight;
+
+	/** Every tree is rooted: parent and the slot of the edge to it, -1 at roots */
+	std::vector<int> parent;
+	std::vector<int> parentSlot;
+	std::vector<std::vector<std::pair<int, int>>> adjacency;
+
+	/** Search workspace */
+	std::vector<int> marks;
+	int epoch;
+	std::vector<int> queue, otherQueue;
+
+	void reroot(int nodeID);
+	int maxEdgeOnPath(int startNodeID, int endNodeID);
+	void unlink(int slot);
+};
+
+#endif //GRAPH_APP_DYNAMICMST_H
@@ -0,0 +1,239 @@
+/**
+ * @file DynamicTopoOrder.cc
+ *
+ * @author agent
+ * @date 2026-10-17
+ *
+ * @brief Defines the class DynamicTopoOrder, a topological order of a
+ * directed acyclic graph kept up to date as edges are inserted, with the
+ * Pearce-Kelly algorithm
+ */
+
+#include "DynamicTopoOrder.h"
+#include "Stats.h"
+#include <algorithm>
+
+using namespace std;
+
+/**
+ * @brief Construct a new DynamicTopoOrder:: DynamicTopoOrder object
+ *
+ */
+DynamicTopoOrder::DynamicTopoOrder() : epoch{0} {
+
+}
+
+/**
+ * @brief Destroy the DynamicTopoOrder:: DynamicTopoOrder object
+ *
+ */
+DynamicTopoOrder::~DynamicTopoOrder() {
+
+}
+
+/**
+ * @brief Releases the graph and the order
+ *
+ */
+void DynamicTopoOrder::clear() {
+    outgoing.clear();
+    incoming.clear();
+    order.clear();
+    nodeAt.clear();
+    marks.clear();
+    epoch = 0;
+}
+
+/**
+ * @brief Orders a graph with Kahn's algorithm. Returns false, leaving the
+ * order empty, if the graph has a cycle.
+ *
+ * @param nodeCount
+ * @param starts: start node of every edge
+ * @param ends: end node of every edge
+ * @return true
+ * @return false if the graph is cyclic
+ */
+bool DynamicTopoOrder::build(int nodeCount, ArrayView<int> starts, ArrayView<int> ends) {
+    clear();
+    outgoing.resize(nodeCount);
+    incoming.resize(nodeCount);
+    vector<int> inDegree(nodeCount, 0);
+    for (size_t e = 0; e < starts.size(); e++) {
+        outgoing[starts[e]].push_back(ends[e]);
+        incoming[ends[e]].push_back(starts[e]);
+        inDegree[ends[e]]++;
+    }
+
+    nodeAt.reserve(nodeCount);
+    for (int u = 0; u < nodeCount; u++) {
+        if (inDegree[u] == 0) {
+            nodeAt.push_back(u);
+        }
+    }
+    for (size_t head = 0; head < nodeAt.size(); head++) {
+        int u = nodeAt[head];
+        STAT_ADD(nodesVisited, 1);
+        STAT_ADD(edgesVisited, outgoing[u].size());
+        for (int v : outgoing[u]) {
+            if (--inDegree[v] == 0) {
+                nodeAt.push_back(v);
+            }
+        }
+    }
+
+    if ((int)nodeAt.size() < nodeCount) {
+        clear();
+        return false;
+    }
+
+    order.resize(nodeCount);
+    for (int i = 0; i < nodeCount; i++) {
+        order[nodeAt[i]] = i;
+    }
+    marks.assign(nodeCount, 0);
+    return true;
+}
+
+/**
+ * @brief Adds a node with no edges at the end of the order
+ *
+ * @return int: the new node
+ */
+int DynamicTopoOrder::addNode() {
+    int nodeID = (int)order.size();
+    outgoing.emplace_back();
+    incoming.emplace_back();
+    order.push_back(nodeID);
+    nodeAt.push_back(nodeID);
+    marks.push_back(0);
+    return nodeID;
+}
+
+/**
+ * @brief Inserts an edge, reordering only the nodes between its endpoints.
+ * If the edge would close a cycle it is not inserted and false is
+ * returned; the order stays valid.
+ *
+ * @param startNodeID
+ * @param endNodeID
+ * @return true
+ * @return false if the edge would close a cycle
+ */
+bool DynamicTopoOrder::addEdge(int startNodeID, int endNodeID) {
+    if (startNodeID == endNodeID) {
+        return false;
+    }
+
+    int lowerBound = order[endNodeID];
+    int upperBound = order[startNodeID];
+    if (lowerBound < upperBound) {
+        // The end node comes after the start node in the order: find the
+        // nodes in between that must move, or the path that closes a cycle
+        epoch++;
+        if (!searchForward(endNodeID, upperBound)) {
+            return false;
+        }
+        searchBackward(startNodeID, lowerBound);
+        reorder();
+    }
+
+    outgoing[startNodeID].push_back(endNodeID);
+    incoming[endNodeID].push_back(startNodeID);
+    return true;
+}
+
+/**
+ * @brief Collects the nodes reachable from startNodeID whose position is
+ * below upperBound. Returns false if the node at upperBound is reached.
+ *
+ * @param startNodeID
+ * @param upperBound
+ * @return true
+ * @return false if a cycle was found
+ */
+bool DynamicTopoOrder::searchForward(int startNodeID, int upperBound) {
+    forwardSet.clear();
+    stack.assign(1, startNodeID);
+    marks[startNodeID] = epoch;
+
+    while (!stack.empty()) {
+        int u = stack.back();
+        stack.pop_back();
+        forwardSet.push_back(u);
+        STAT_ADD(nodesVisited, 1);
+        STAT_ADD(edgesVisited, outgoing[u].size());
+
+        for (int v : outgoing[u]) {
+            if (order[v] == upperBound) {
+                return false;
+            }
+            if (marks[v] != epoch && order[v] < upperBound) {
+                marks[v] = epoch;
+                stack.push_back(v);
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Collects the nodes that reach startNodeID and whose position is
+ * above lowerBound
+ *
+ * @param startNodeID
+ * @param lowerBound
+ */
+void DynamicTopoOrder::searchBackward(int startNodeID, int lowerBound) {
+    backwardSet.clear();
+    stack.assign(1, startNodeID);
+    marks[startNodeID] = epoch;
+
+    while (!stack.empty()) {
+        int u = stack.back();
+        stack.pop_back();
+        backwardSet.push_back(u);
+        STAT_ADD(nodesVisited, 1);
+        STAT_ADD(edgesVisited, incoming[u].size());
+
+        for (int v : incoming[u]) {
+            if (marks[v] != epoch && order[v] > lowerBound) {
+                marks[v] = epoch;
+                stack.push_back(v);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Moves the backward set before the forward set, reusing the
+ * positions both sets held. Nodes keep their relative order within
+ * each set.
+ *
+ */
+void DynamicTopoOrder::reorder() {
+    auto byPosition = [&](int a, int b) {
+        return order[a] < order[b];
+    };
+    sort(forwardSet.begin(), forwardSet.end(), byPosition);
+    sort(backwardSet.begin(), backwardSet.end(), byPosition);
+
+    positions.clear();
+    for (int u : backwardSet) {
+        positions.push_back(order[u]);
+    }
+    for (int u : forwardSet) {
+        positions.push_back(order[u]);
+    }
+    sort(positions.begin(), positions.end());
+
+    size_t i = 0;
+    for (int u : backwardSet) {
+        order[u] = positions[i];
+        nodeAt[positions[i++]] = u;
+    }
+    for (int u : forwardSet) {
+        order[u] = positions[i];
+        nodeAt[positions[i++]] = u;
+    }
+}
@@ -0,0 +1,51 @@
+/**
+ * @file DynamicTopoOrder.h
+ *
+ * @author agent
+ * @date 2026-10-17
+ *
+ * @brief Defines the class DynamicTopoOrder, a topological order of a
+ * directed acyclic graph kept up to date as edges are inserted, with the
+ * Pearce-Kelly algorithm
+ */
+
+#ifndef GRAPH_APP_DYNAMICTOPOORDER_H
+#define GRAPH_APP_DYNAMICTOPOORDER_H
+
+#include "CSRGraph.h"
+#include <vector>
+
+class DynamicTopoOrder {
+	public:
+	/**	Constructors/Destructors */
+	DynamicTopoOrder();
+	~DynamicTopoOrder();
+
+	/** Building methods */
+	bool build(int nodeCount, ArrayView<int> starts, ArrayView<int> ends);
+	void clear();
+
+	/** Editing methods */
+	int addNode();
+	bool addEdge(int startNodeID, int endNodeID);
+
+	/** Accessor methods */
+	int position(int nodeID) const { return order[nodeID]; };
+	int getNodeCount() const { return (int)order.size(); };
+
+	private:
+	std::vector<std::vector<int>> outgoing, incoming;
+	std::vector<int> order;		// position of every node
+	std::vector<int> nodeAt;	// node at every position
+
+	/** Search workspace, reused between insertions */
+	std::vector<int> marks;
+	int epoch;
+	std::vector<int> forwardSet, backwardSet, stack, positions;
+
+	bool searchForward(int startNodeID, int upperBound);
+	void searchBackward(int startNodeID, int lowerBound);
+	void reorder();
+};
+
+#endif //GRAPH_APP_DYNAMICTOPOORDER_H
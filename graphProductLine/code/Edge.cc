@@ -40,7 +40,6 @@ Edge::~Edge (){
 int Edge::getNext(int currentNodeID){
 	if (startNodeID != currentNodeID) {
 		return startNodeID;
-	} else if (endNodeID != currentNodeID) {
-		return endNodeID;
 	}
+	return endNodeID;
 }
\ No newline at end of file
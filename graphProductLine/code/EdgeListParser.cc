@@ -0,0 +1,140 @@
+/**
+ * @file EdgeListParser.cc
+ *
+ * @author agent
+ * @date 2026-10-17
+ *
+ * @brief Defines the class EdgeListParser, a zero-allocation tokenizer for
+ * whitespace separated text such as edge lists and feature configs
+ */
+
+#include "EdgeListParser.h"
+#include <charconv>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+using namespace std;
+
+/**
+ * @brief Construct a new EdgeListParser:: EdgeListParser object over a
+ * buffer, usually a mapped file or a newline-aligned chunk of one
+ *
+ * @param begin
+ * @param end
+ * @param firstLineNumber: number of the first line, for error messages
+ */
+EdgeListParser::EdgeListParser(const char* begin, const char* end, size_t firstLineNumber)
+    : cursor{begin}, end{end}, lineNumber{firstLineNumber - 1} {
+
+}
+
+/**
+ * @brief Destroy the EdgeListParser:: EdgeListParser object
+ *
+ */
+EdgeListParser::~EdgeListParser() {
+
+}
+
+/**
+ * @brief Returns the first newline in [begin, end), or end. Compares 32
+ * (AVX2) or 16 (SSE2) bytes at a time, with a scalar loop for the tail.
+ *
+ * @param begin
+ * @param end
+ * @return const char*
+ */
+const char* EdgeListParser::findNewline(const char* begin, const char* end) {
+    const char* p = begin;
+
+#if defined(__AVX2__)
+    const __m256i newline = _mm256_set1_epi8('\n');
+    while (end - p >= 32) {
+        __m256i block = _mm256_loadu_si256((const __m256i*)p);
+        unsigned mask = (unsigned)_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, newline));
+        if (mask != 0) {
+            return p + __builtin_ctz(mask);
+        }
+        p += 32;
+    }
+#elif defined(__SSE2__)
+    const __m128i newline = _mm_set1_epi8('\n');
+    while (end - p >= 16) {
+        __m128i block = _mm_loadu_si128((const __m128i*)p);
+        unsigned mask = (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(block, newline));
+        if (mask != 0) {
+            return p + __builtin_ctz(mask);
+        }
+        p += 16;
+    }
+#endif
+
+    while (p < end && *p != '\n') {
+        p++;
+    }
+    return p;
+}
+
+/**
+ * @brief Reads the next line and splits it on spaces, tabs and carriage
+ * returns. Fields point into the buffer. Up to maxFields fields are
+ * stored; fieldCount receives the number of fields on the line.
+ *
+ * @param fields
+ * @param maxFields
+ * @param fieldCount
+ * @return true if a line was read
+ * @return false at the end of the buffer
+ */
+bool EdgeListParser::nextLine(string_view fields[], int maxFields, int& fieldCount) {
+    if (cursor >= end) {
+        return false;
+    }
+
+    const char* lineEnd = findNewline(cursor, end);
+    lineNumber++;
+    fieldCount = 0;
+
+    // Fields are short, so splitting them is left to a scalar loop
+    const char* p = cursor;
+    while (p < lineEnd) {
+        while (p < lineEnd && (*p == ' ' || *p == '\t' || *p == '\r')) {
+            p++;
+        }
+        const char* fieldBegin = p;
+        while (p < lineEnd && *p != ' ' && *p != '\t' && *p != '\r') {
+            p++;
+        }
+        if (p > fieldBegin) {
+            if (fieldCount < maxFields) {
+                fields[fieldCount] = string_view(fieldBegin, p - fieldBegin);
+            }
+            fieldCount++;
+        }
+    }
+
+    cursor = lineEnd + 1;
+    return true;
+}
+
+/**
+ * @brief Parses a whole field as a base-10 integer
+ *
+ * @param text
+ * @param value
+ * @return true
+ * @return false if the field is not a valid integer or is out of range
+ */
+bool EdgeListParser::parseInt(string_view text, int& value) {
+    const char* first = text.data();
+    const char* last = text.data() + text.size();
+    if (first < last && *first == '+') {
+        first++;
+    }
+    from_chars_result result = from_chars(first, last, value);
+    return result.ec == errc() && result.ptr == last;
+}
@@ -0,0 +1,36 @@
+/**
+ * @file EdgeListParser.h
+ *
+ * @author agent
+ * @date 2026-10-17
+ *
+ * @brief Defines the class EdgeListParser, a zero-allocation tokenizer for
+ * whitespace separated text such as edge lists and feature configs
+ */
+
+#ifndef GRAPH_APP_EDGELISTPARSER_H
+#define GRAPH_APP_EDGELISTPARSER_H
+
+#include <cstddef>
+#include <string_view>
+
+class EdgeListParser {
+	public:
+	/**	Constructors/Destructors */
+	EdgeListParser(const char* begin, const char* end, size_t firstLineNumber = 1);
+	~EdgeListParser();
+
+	/** Parsing methods */
+	bool nextLine(std::string_view fields[], int maxFields, int& fieldCount);
+	size_t getLineNumber() const { return lineNumber; };
+
+	static bool parseInt(std::string_view text, int& value);
+	static const char* findNewline(const char* begin, const char* end);
+
+	private:
+	const char* cursor;
+	const char* end;
+	size_t lineNumber;
+};
+
+#endif //GRAPH_APP_EDGELISTPARSER_H
@@ -8,11 +8,13 @@
  */
 
 #include "GraphApp.h"
+#include <charconv>
+#include <chrono>
+#include <fcntl.h>
 #include <iostream>
-#include <fstream>
+#include <unistd.h>
 #include <string>
 #include <vector>
-#include <sstream>
 
 using namespace std;
 
@@ -24,18 +26,78 @@ bool kBFS;
 bool kDFS;
 bool kCycle;
 bool kConnectedComps;
+bool kStronglyConnectedComps;
 bool kPrim;
+bool kKruskal;
+bool kShortestPath;
+bool kCSR;
+bool kAcyclic;
 
 
+/**
+ * @brief Returns the default options with the given files
+ * 
+ * @param configFilename 
+ * @param graphFilename 
+ * @return AppOptions 
+ */
+static AppOptions fileOptions(const string& configFilename, const string& graphFilename) {
+    AppOptions options;
+    options.configFilename = configFilename;
+    options.graphFilename = graphFilename;
+    return options;
+}
+
 /**
  * @brief Construct a new Graph App:: Graph App object
  * 
  * @param filename 
  */
-GraphApp::GraphApp(string configFilename, string graphFilename) {
-    loadConfig(configFilename);
+GraphApp::GraphApp(string configFilename, string graphFilename) : GraphApp(fileOptions(configFilename, graphFilename)) {
+
+}
+
+/**
+ * @brief Construct a new Graph App:: Graph App object from command line options
+ * 
+ * @param options 
+ */
+GraphApp::GraphApp(const AppOptions& options) : csrDirty{true}, reverseDirty{true}, componentsReady{false},
+    topoReady{false}, topoCyclic{false}, mstReady{false}, graphVersion{0}, cacheVersion{0},
+    cacheResults{options.cacheResults}, builderReady{true},
+    threadCount{options.threadCount > 0 ? options.threadCount : defaultThreadCount()},
+    out{&cout}, batchMode{false}, timing{options.timing}, statsFilename{options.statsFilename}, nextArgument{0} {
+    Scheduler::global().setWorkerCount(threadCount - 1);
+
+    if (!options.outputFilename.empty()) {
+        int fd = ::open(options.outputFilename.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (fd < 0) {
+            cerr << "Unable to open output file" << '\n';
+        } else {
+            fileBuffer.reset(new OutputBuffer(fd, 1 << 20, true));
+            fileOut.reset(new ostream(fileBuffer.get()));
+            out = fileOut.get();
+        }
+    }
+
+    loadConfig(options.configFilename);
+    if (options.storage == "csr") {
+        kCSR = true;
+    } else if (options.storage == "lists") {
+        kCSR = false;
+    }
     
-    loadGraph(graphFilename);
+    auto start = chrono::steady_clock::now();
+    loadGraph(options.graphFilename, options.format, options.verifySnapshot);
+    if (timing) {
+        cerr << "load: " << chrono::duration<double, milli>(chrono::steady_clock::now() - start).count() << " ms" << '\n';
+    }
+    checkAcyclic();
+    if (options.stats) {
+        freezeGraph();
+        cerr << "nodes: " << nodeCount() << '\n' << "edges: " << csr.getEdgeCount() << '\n' <<
+        "threads: " << threadCount << '\n' << "storage: " << (kCSR ? "csr" : "lists") << '\n';
+    }
 
     setupMenu();
 
@@ -47,9 +109,12 @@ GraphApp::GraphApp(string configFilename, string graphFilename) {
  * 
  */
 GraphApp::~GraphApp() {
-    //First, deletes the recipes.
-    for (int i = 0; i < nodes.size(); i++)
-        delete nodes.at(i);
+    //Nodes and edges are freed with their arenas.
+#if GRAPH_STATS
+    if (!statsFilename.empty() && !commandStats.save(statsFilename)) {
+        cerr << "Unable to save stats" << '\n';
+    }
+#endif
 }
 
 /**
@@ -64,16 +129,37 @@ void GraphApp::setupMenu() {
     
     if (kConnectedComps){
         activeCommands.push_back(CC);
+        activeCommands.push_back(CONNECTED);
+        activeCommands.push_back(COMPONENTCOUNT);
+    } 
+
+    if (kStronglyConnectedComps){
+        activeCommands.push_back(SCC);
     } 
         
     if (kPrim){
         activeCommands.push_back(PRIM);
     } 
+
+    if (kKruskal){
+        activeCommands.push_back(KRUSKAL);
+    } 
+
+    if (kShortestPath){
+        activeCommands.push_back(SHORTESTPATH);
+    } 
+
+    if (kBFS){
+        activeCommands.push_back(BFSEARCH);
+    } 
     activeCommands.push_back(ADDEDGE);
     activeCommands.push_back(ADDNODE);
     activeCommands.push_back(UPDATEEDGE);
     activeCommands.push_back(UPDATENODE);
     activeCommands.push_back(PRINTGRAPH);
+    activeCommands.push_back(SAVESNAPSHOT);
+    activeCommands.push_back(STATS);
+    activeCommands.push_back(SAVESTATS);
     activeCommands.push_back(HELP);
     activeCommands.push_back(EXIT);
 }
@@ -84,22 +170,25 @@ void GraphApp::setupMenu() {
  * @param configFilename 
  */
 void GraphApp::loadConfig (string configFilename){
-    ifstream configFile (configFilename);
-
-    if (configFile.is_open()) {
-        string line;
+    MappedFile configFile;
 
-        while ( getline (configFile, line) )
-        {
-            stringstream ss(line);
-            vector<string> vect;
+    if (configFile.open(configFilename)) {
+        EdgeListParser parser(configFile.data(), configFile.end());
+        string_view fields[2];
+        int fieldCount;
 
-            for (string i; ss >> i;) {
-                vect.push_back(i);
+        while (parser.nextLine(fields, 2, fieldCount)) {
+            if (fieldCount == 0) {
+                continue;
+            }
+            if (fieldCount < 2) {
+                *out << configFilename << ":" << parser.getLineNumber() << 
+                ": expected a feature and a toggle value" << '\n';
+                continue;
             }
 
-            string feature = vect[0];
-            bool toggleValue = (vect[1][0] == '1');
+            string_view feature = fields[0];
+            bool toggleValue = (fields[1][0] == '1');
 
             if (feature == "kWeighted" ){
                 kWeighted = toggleValue;
@@ -117,13 +206,22 @@ void GraphApp::loadConfig (string configFilename){
                 kCycle = toggleValue;
             } else if (feature == "kConnectedComps" ){
                 kConnectedComps = toggleValue;
+            } else if (feature == "kStronglyConnectedComps" ){
+                kStronglyConnectedComps = toggleValue;
             } else if (feature == "kPrim" ){
                 kPrim = toggleValue;
+            } else if (feature == "kKruskal" ){
+                kKruskal = toggleValue;
+            } else if (feature == "kShortestPath" ){
+                kShortestPath = toggleValue;
+            } else if (feature == "kCSR" ){
+                kCSR = toggleValue;
+            } else if (feature == "kAcyclic" ){
+                kAcyclic = toggleValue;
             }
 
         }
-        configFile.close();
-    } else cout << "Unable to open configFile" << endl;
+    } else *out << "Unable to open configFile" << '\n';
 }
 
 /**
@@ -135,12 +233,40 @@ void GraphApp::loadConfig (string configFilename){
  */
 
 bool GraphApp::checkNode (string nodeName) {
-    for (int i=0; i < nodes.size(); i++) {
-        if (nodes[i]->getName() == nodeName) {
-            return true;
+    return nameIndex.contains(nodeName);
+}
+
+/**
+ * @brief Returns the ID of the node with the provided name, creating
+ * the node first if it doesn't exist yet
+ * 
+ * @param nodeName 
+ * @return int 
+ */
+int GraphApp::internNode(string_view nodeName) {
+    int nodeID = nameIndex.find(nodeName);
+    if (nodeID == -1) {
+        Node* newNode = nodeArena.create(string(nodeName));
+        nodeID = (int)nodes.size();
+        nodes.push_back(newNode);
+        if (kWeighted) {
+            edges.emplace_back();
+        }
+        nameIndex.insert(nodeName, nodeID);
+        csrDirty = true;
+        graphVersion++;
+
+        if (componentsReady) {
+            componentSets.addElement();
+        }
+        if (topoReady && !topoCyclic) {
+            topoOrder.addNode();
+        }
+        if (mstReady) {
+            mstCache.addNode();
         }
     }
-    return false;
+    return nodeID;
 }
 
 /**
@@ -150,11 +276,11 @@ bool GraphApp::checkNode (string nodeName) {
  */
 
 void GraphApp::addNode(std::string nodeName) {
+    thawGraph();
     if (checkNode(nodeName)) {
-        cout << "Node already exists!" << endl;
+        *out << "Node already exists!" << '\n';
     } else {
-        Node* newNode = new Node(nodeName);
-        nodes.push_back(newNode);
+        internNode(nodeName);
     }
 }
 
@@ -166,34 +292,29 @@ void GraphApp::addNode(std::string nodeName) {
  * @param weight 
  */
 void GraphApp::addEdge(std::string startNodeName, std::string endNodeName, int weight) {
-    if(!checkNode(startNodeName)) {
-        Node* newNode = new Node(startNodeName);
-        nodes.push_back(newNode);
+    thawGraph();
+    int startNodeID, endNodeID;
+    if (!admitEdge(startNodeName, endNodeName, startNodeID, endNodeID)) {
+        return;
     }
+    graphVersion++;
 
-    if(!checkNode(endNodeName)) {
-        Node* newNode = new Node(endNodeName);
-        nodes.push_back(newNode);
-    }
-    
-    for (Node * n1 : nodes){
-        for (Node * n2: nodes){
-            if (n1->getName() == startNodeName &&
-                n2->getName() == endNodeName) {
+    if (kWeighted) {
+        Edge* edge = edgeArena.create(startNodeID, endNodeID, weight);
+        edges[startNodeID].push_back(edge);
 
-                if (kWeighted) {
-                    Edge* edge = new Edge(n1->getID(), n2->getID(), weight);
-                    edges[n1->getID()].push_back(edge);
+        if (kUndirected){
+            edges[endNodeID].push_back(edge);
+        }
+        csrDirty = true;
 
-                    if (kUndirected){
-                        edges[n2->getID()].push_back(edge);
-                    }
-                }
-            
-            }    
-            
+        if (mstReady && kUndirected) {
+            mstCache.insertEdge(startNodeID, endNodeID, weight);
         }
+    }
 
+    if (componentsReady && kUndirected) {
+        componentSets.unite(startNodeID, endNodeID);
     }
 }
 
@@ -204,31 +325,24 @@ void GraphApp::addEdge(std::string startNodeName, std::string endNodeName, int w
  * @param endNode 
  */
 void GraphApp::addEdge(std::string startNodeName, std::string endNodeName) {
-    if(!checkNode(startNodeName)) {
-        Node* newNode = new Node(startNodeName);
-        nodes.push_back(newNode);
+    thawGraph();
+    int startNodeID, endNodeID;
+    if (!admitEdge(startNodeName, endNodeName, startNodeID, endNodeID)) {
+        return;
     }
+    graphVersion++;
 
-    if(!checkNode(endNodeName)) {
-        Node* newNode = new Node(endNodeName);
-        nodes.push_back(newNode);
-    }
-    
-    for (Node * n1 : nodes){
-        for (Node * n2: nodes){
-            if (n1->getName() == startNodeName &&
-                n2->getName() == endNodeName) {
-                if (!kWeighted) {
-                    n1->addNeighbor(n2->getID());
-                    
-                    if (kUndirected){
-                        n2->addNeighbor(n1->getID());
-                    }                    
-                }           
-            }    
-            
+    if (!kWeighted) {
+        nodes[startNodeID]->addNeighbor(endNodeID);
+
+        if (kUndirected){
+            nodes[endNodeID]->addNeighbor(startNodeID);
         }
+        csrDirty = true;
+    }
 
+    if (componentsReady && kUndirected) {
+        componentSets.unite(startNodeID, endNodeID);
     }
 }
 
@@ -239,10 +353,15 @@ void GraphApp::addEdge(std::string startNodeName, std::string endNodeName) {
  * @param newName 
  */
 void GraphApp::updateNodeName(std::string nodeName, std::string newName) {
-    for (int i=0; i < nodes.size(); i++) {
-        if (nodes[i]->getName() == nodeName) {
-            nodes[i]->name = nodeName;
-        }
+    thawGraph();
+    int nodeID = nameIndex.find(nodeName);
+    if (nodeID == -1) {
+        *out << "Node not found!" << '\n';
+    } else if (!nameIndex.rename(nodeName, newName)) {
+        *out << "Node already exists!" << '\n';
+    } else {
+        nodes[nodeID]->name = newName;
+        graphVersion++;
     }
 }
 
@@ -254,311 +373,508 @@ void GraphApp::updateNodeName(std::string nodeName, std::string newName) {
  * @param newWeight 
  */
 void GraphApp::updateEdgeWeight(std::string startNodeName, std::string endNodeName, int newWeight) {
-    int startNodeID, endNodeID;
+    thawGraph();
+    int startNodeID = nameIndex.find(startNodeName);
+    int endNodeID = nameIndex.find(endNodeName);
 
-    for (int i=0; i < nodes.size(); i++) {
-        if (nodes[i]->getName() == startNodeName) {
-            startNodeID = nodes[i]->getID();
-        }
-        if (nodes[i]->getName() == endNodeName) {
-            endNodeID = nodes[i]->getID();
-        }
+    if (startNodeID == -1 || endNodeID == -1) {
+        *out << "Edge not found!" << '\n';
+        return;
     }
     
-    for (int i=0; i < edges[startNodeID].size(); i++) {
-        if (edges[startNodeID][i]->getEndNodeID() == endNodeID) {
-            edges[startNodeID][i]->weight = newWeight;
+    for (Edge* edge : edges[startNodeID]) {
+        if (edge->getEndNodeID() == endNodeID && edge->getWeight() != newWeight) {
+            edge->weight = newWeight;
+            graphVersion++;
+            if (mstReady) {
+                repairMST(edge->getStartNodeID(), edge->getEndNodeID(), newWeight);
+            }
         }
     }
 
     if (kUndirected) {
-        for (int i=0; i < edges[endNodeID].size(); i++) {
-            if (edges[endNodeID][i]->getStartNodeID() == startNodeID) {
-                edges[endNodeID][i]->weight = newWeight;
+        for (Edge* edge : edges[endNodeID]) {
+            if (edge->getStartNodeID() == startNodeID && edge->getWeight() != newWeight) {
+                edge->weight = newWeight;
+                graphVersion++;
+                if (mstReady) {
+                    repairMST(edge->getStartNodeID(), edge->getEndNodeID(), newWeight);
+                }
             }
         }
     }
 
+    csrDirty = true;
+
 }
 
 /**
  * @brief Loads the graph from the provided file
  * 
  * @param graphFilename 
+ * @param format: "text", "snapshot", or "auto" to detect snapshots by
+ * their magic number
+ * @param verifySnapshot: check every array of a snapshot
  */
-void GraphApp::loadGraph (string graphFilename) {
-    ifstream graphFile (graphFilename);
-    int nodeCount = 0;
-    int edgeCount = 0;
-
-    if (graphFile.is_open()) {
-        string line;
+void GraphApp::loadGraph (string graphFilename, string format, bool verifySnapshot) {
+    if (format == "snapshot" || (format != "text" && GraphSnapshot::isSnapshot(graphFilename))) {
+        loadSnapshot(graphFilename, verifySnapshot);
+        return;
+    }
 
-        // Read edges until end of file
-        while (getline (graphFile, line)) {
-            //Extract name of node in the edge
-            stringstream ss(line);
-            vector<string> lineElems;
+    MappedFile& graphFile = graphText;
+
+    if (graphFile.open(graphFilename, true)) {
+        // Large edge lists are parsed on every core and frozen straight
+        // into CSR arrays; the names stay in the mapped file
+        if (threadCount > 1 && graphFile.size() >= ParallelLoader::MIN_PARALLEL_BYTES) {
+            ParallelLoader loader(threadCount);
+            loader.load(graphFile, graphFilename, kWeighted, kDirected, csr, frozenNames, *out);
+            csrDirty = false;
+            reverseDirty = true;
+            builderReady = false;
+            return;
+        }
 
-            for (string lineElem; ss >> lineElem;) {
-                lineElems.push_back(lineElem);
-            }
+        EdgeListParser parser(graphFile.data(), graphFile.end());
+        string_view lineElems[3];
+        int elemCount;
+        int expectedElems = kWeighted ? 3 : 2;
 
-            string startNode = lineElems[0];
-            string endNode = lineElems[1];
-            int weight;
-            if (kWeighted) {
-                weight = stoi(lineElems[2]);
+        // Read edges until end of file
+        while (parser.nextLine(lineElems, 3, elemCount)) {
+            if (elemCount == 0) {
+                continue;
             }
-
-            if(!checkNode(startNode)) {
-                Node* newNode = new Node(startNode);
-                nodes.push_back(newNode);
+            if (elemCount < expectedElems) {
+                *out << graphFilename << ":" << parser.getLineNumber() << ": expected " <<
+                (kWeighted ? "start node, end node and weight" : "start node and end node") << '\n';
+                continue;
             }
 
-            if(!checkNode(endNode)) {
-                Node* newNode = new Node(endNode);
-                nodes.push_back(newNode);
+            int weight = 0;
+            if (kWeighted && !EdgeListParser::parseInt(lineElems[2], weight)) {
+                *out << graphFilename << ":" << parser.getLineNumber() << ": invalid weight '" <<
+                lineElems[2] << "'" << '\n';
+                continue;
             }
 
-            for (int i=0; i < nodes.size(); i++) {
-               for (int j=0; j < nodes.size(); j++) {
-                    if (nodes[i]->getName() == startNode &&
-                        nodes[j]->getName() == endNode) {
-                        if (!kWeighted) {
-                            nodes[i]->addNeighbor(nodes[j]->getID());
-                            
-                            if (kUndirected){
-                                nodes[j]->addNeighbor(nodes[i]->getID());
-                            }                    
-                        }
+            int startNodeID = internNode(lineElems[0]);
+            int endNodeID = internNode(lineElems[1]);
 
-                        if (kWeighted) {
-                            Edge* edge = new Edge(nodes[i]->getID(), nodes[j]->getID(), weight);
-                            edges[nodes[i]->getID()].push_back(edge);
+            if (!kWeighted) {
+                nodes[startNodeID]->addNeighbor(endNodeID);
 
-                            if (kUndirected){
-                                edges[nodes[j]->getID()].push_back(edge);
-                            }
-                        }
-                    
-                    }    
-                    
+                if (kUndirected){
+                    nodes[endNodeID]->addNeighbor(startNodeID);
                 }
+            }
+
+            if (kWeighted) {
+                Edge* edge = edgeArena.create(startNodeID, endNodeID, weight);
+                edges[startNodeID].push_back(edge);
 
-            }          
+                if (kUndirected){
+                    edges[endNodeID].push_back(edge);
+                }
+            }
         }
         
+        csrDirty = true;
         graphFile.close();
 
-    } else cout << "Unable to graphFile" << endl;
+    } else *out << "Unable to graphFile" << '\n';
 }
 
 /**
- * @brief Prints neighbors in the adjacency list all the nodes
+ * @brief Rebuilds the CSR copy of the graph if it was edited since
+ * the last time it was frozen
  * 
  */
-void GraphApp::printNeighbors() {
-    for (Node * node : nodes){
-        cout << node->getName();
-        cout << " neighbors: ";
-        for (int neighbor : node->getNeighbors()) {
-            cout << nodes[neighbor]->getName() << " ";
-        }
-        cout << endl;
+void GraphApp::freezeGraph() {
+    if (csrDirty && builderReady) {
+        csr.build(nodes, edges, kWeighted, kDirected);
+        csrDirty = false;
+        reverseDirty = true;
     }
 }
 
 /**
- * @brief Prints all edges elements
+ * @brief Makes sure the storage used by row() is up to date: the CSR
+ * arrays if kCSR, the mutable Node/Edge structures otherwise
  * 
  */
-void GraphApp::printEdges() {
-    for (size_t i = 0; i < nodes.size(); i++) {
-        cout << "Edges from node: " << nodes[i]->getName() << endl; 
-        for (Edge * edge : edges[i]){
-            cout << nodes[edge->getStartNodeID()]->getName() << "-";
-            cout << edge->getWeight() << "-";
-            cout << nodes[edge->getEndNodeID()]->getName();
-            cout << endl;
-        }
+void GraphApp::prepareStorage() {
+    if (kCSR) {
+        freezeGraph();
+    } else {
+        thawGraph();
     }
 }
 
 /**
- * @brief Traverses the graph in Depth-First search while executing the command
+ * @brief Rebuilds the mutable Node/Edge structures from the CSR arrays
+ * when the graph was opened from a snapshot. Edges are created in edge
+ * list order, so freezing the graph again gives the same neighbor order.
  * 
- * @param nodeID: starting node for the traversal
- * @param command: operation performed at each traversed node
- * @param parent: id of the parent node
  */
-bool GraphApp::DFS(int nodeID, int parent, string command) {
-    visited[nodeID] = true;
-
-    if (kDirected) {
-        if (command == CYCLE) {
-            recurStack[nodeID] = true;
-        }
+void GraphApp::thawGraph() {
+    if (builderReady) {
+        return;
     }
 
-    if (kUndirected) {
-        if (command == CC) {
-            cout << nodeID << " ";
-        }
+    indexNames();
+    int count = csr.getNodeCount();
+    nodes.reserve(count);
+    nodeArena.reserve(count);
+    for (int u = 0; u < count; u++) {
+        nodes.push_back(nodeArena.create(string(nodeName(u))));
     }
 
     if (kWeighted) {
-        for (Edge* edge : edges[nodeID]) {
-            int endNodeID = edge->getEndNodeID();
-            
-            if (kDirected) {
-                if (command == CYCLE){
-                    if (visited[endNodeID] == false) {
-                        if(DFS(endNodeID, nodeID, CYCLE)) return true;
-                    } else if (recurStack[endNodeID]) {
-                        return true;
-                    }
-                }
+        edges.resize(count);
+        edgeArena.reserve(csr.getEdgeCount());
+        for (int e = 0; e < csr.getEdgeCount(); e++) {
+            Edge* edge = edgeArena.create(csr.edgeStarts[e], csr.edgeEnds[e], csr.edgeWeights[e]);
+            edges[edge->getStartNodeID()].push_back(edge);
+
+            if (kUndirected){
+                edges[edge->getEndNodeID()].push_back(edge);
             }
+        }
+    } else {
+        for (int u = 0; u < count; u++) {
+            nodes[u]->neighbors.assign(csr.targets.begin() + csr.offsets[u],
+                csr.targets.begin() + csr.offsets[u + 1]);
+        }
+    }
 
-            if (kUndirected) {
-                int startNodeID = edge->getStartNodeID();
-                int next;
-                if (startNodeID != nodeID) {
-                    next = startNodeID;
-                } else if (endNodeID != nodeID) {
-                    next = endNodeID;
-                }
+    builderReady = true;
+    frozenNames.clear();
+    graphText.close();
+}
 
-                if (command == CYCLE) {
-                    if (visited[next] == false) {
-                        if (DFS(next, nodeID, CYCLE)) return true;
-                    } else if (next != parent) {
-                        return true;
-                    }
-                }
+/**
+ * @brief Fills the name index from the snapshot or loaded names the
+ * first time a node is looked up by name
+ * 
+ */
+void GraphApp::indexNames() {
+    if (builderReady || (int)nameIndex.size() == csr.getNodeCount()) {
+        return;
+    }
 
-                if (command == CC) {
-                    if (visited[next] == false) {
-                        if (DFS(next, 0, CC)) return true;
-                    }
-                }
-            }
+    nameIndex.reserve(csr.getNodeCount());
+    for (int u = 0; u < csr.getNodeCount(); u++) {
+        nameIndex.insert(nodeName(u), u);
+    }
+}
 
-        }
+/**
+ * @brief Number of nodes in the graph
+ * 
+ * @return int 
+ */
+int GraphApp::nodeCount() {
+    return builderReady ? (int)nodes.size() : csr.getNodeCount();
+}
+
+/**
+ * @brief Name of a node, from the mutable structures, the snapshot or
+ * the mapped graph file
+ * 
+ * @param nodeID 
+ * @return std::string_view 
+ */
+string_view GraphApp::nodeName(int nodeID) {
+    if (builderReady) {
+        return nodes[nodeID]->name;
     }
+    return frozenNames.empty() ? snapshot.name(nodeID) : frozenNames[nodeID];
+}
 
-    if (!kWeighted){
-        for (int neighborID : nodes[nodeID]->getNeighbors()) {
-            if (kDirected) {
-                if (command == CYCLE) {
-                    if (visited[neighborID] == false) {
-                        if(DFS(neighborID, nodeID, CYCLE)) return true;
-                    } else if (recurStack[neighborID]) {
-                        return true;
-                    }
-                }
-            }
+/**
+ * @brief Opens a binary snapshot written by saveSnapshot. The CSR arrays
+ * are used straight from the mapped file; the mutable structures are only
+ * built if the graph is edited.
+ * 
+ * @param snapshotFilename 
+ * @param verify: check every array before using it
+ */
+void GraphApp::loadSnapshot(string snapshotFilename, bool verify) {
+    if (!snapshot.open(snapshotFilename, csr, verify)) {
+        *out << "Unable to open snapshot" << '\n';
+        return;
+    }
 
-            if (kUndirected) {
-                if (command == CYCLE) {
-                    if (visited[neighborID] == false) {
-                        if(DFS(neighborID, nodeID, CYCLE)) return true;
-                    } else if (neighborID != parent) {
-                        return true;
-                    }
-                }
+    if (csr.isWeighted() != kWeighted || csr.isDirected() != kDirected) {
+        *out << "Snapshot doesn't match the feature configuration" << '\n';
+        csr.clear();
+        snapshot.close();
+        return;
+    }
 
-                if (command == CC) {
-                    if (visited[neighborID] == false) {
-                        DFS(neighborID, 0, CC);
-                    }
-                }
-            }
+    csrDirty = false;
+    reverseDirty = true;
+    builderReady = false;
+}
 
-        }
+/**
+ * @brief Writes the graph to a binary snapshot file
+ * 
+ * @param snapshotFilename 
+ */
+void GraphApp::saveSnapshot(string snapshotFilename) {
+    freezeGraph();
+    if (GraphSnapshot::write(snapshotFilename, csr, [this](int nodeID) { return nodeName(nodeID); })) {
+        *out << "Snapshot saved to " << snapshotFilename << '\n';
+    } else {
+        *out << "Unable to write snapshot" << '\n';
     }
+}
 
-    if(kDirected) {
-        if(command == CYCLE){
-            recurStack[nodeID] = false;
-        }
+/**
+ * @brief Returns the frozen graph with every edge reversed. Undirected
+ * graphs are their own transpose.
+ * 
+ * @return const CSRGraph& 
+ */
+const CSRGraph& GraphApp::reverseGraph() {
+    freezeGraph();
+    if (!kDirected) {
+        return csr;
     }
-    return false;
+    if (reverseDirty) {
+        reverseCsr.buildTranspose(csr);
+        reverseDirty = false;
+    }
+    return reverseCsr;
+}
 
+/**
+ * @brief Returns the outgoing edges of a node from the active storage:
+ * the frozen CSR arrays if kCSR, the mutable Node/Edge structures otherwise
+ * 
+ * @param nodeID 
+ * @return AdjacencyRow 
+ */
+AdjacencyRow GraphApp::row(int nodeID) {
+    return dispatchPolicy(kWeighted, kDirected, kCSR, [&](auto policy) {
+        return row<decltype(policy)>(nodeID);
+    });
 }
 
 /**
- * @brief Traverses the graph in Breadth-First search while executing the command
+ * @brief Returns the outgoing edges of a node from the storage of the
+ * policy. Kernels call it once per visited node, so it tests no runtime
+ * features.
  * 
- * @param nodeID: starting node for the traversal
- * @param command: operation performed at each traversed node
+ * @param nodeID 
+ * @tparam Policy: graph features and storage of the product
+ * @return AdjacencyRow 
+ */
+template <class Policy>
+AdjacencyRow GraphApp::row(int nodeID) {
+    if constexpr (Policy::csr) {
+        int begin = csr.offsets[nodeID];
+        return AdjacencyRow{nodeID, csr.degree(nodeID),
+            csr.targets.data() + begin,
+            Policy::weighted ? csr.weights.data() + begin : nullptr,
+            csr.edgeIDs.empty() ? nullptr : csr.edgeIDs.data() + begin,
+            nullptr};
+    } else if constexpr (Policy::weighted) {
+        const vector<Edge*>& nodeEdges = edges[nodeID];
+        return AdjacencyRow{nodeID, (int)nodeEdges.size(), nullptr, nullptr, nullptr, nodeEdges.data()};
+    } else {
+        const vector<int>& neighbors = nodes[nodeID]->neighbors;
+        return AdjacencyRow{nodeID, (int)neighbors.size(), neighbors.data(), nullptr, nullptr, nullptr};
+    }
+}
+
+/**
+ * @brief Returns the i-th edge of an adjacency row, with the orientation
+ * it was added in
+ * 
+ * @param adjacency 
+ * @param i 
+ * @return TreeEdge 
  */
-void GraphApp::BFS(int nodeID, string command) {
-    visited[nodeID] = true;
+TreeEdge GraphApp::rowEdge(const AdjacencyRow& adjacency, int i) {
+    int startNodeID, endNodeID;
+    if (adjacency.edges) {
+        startNodeID = adjacency.edges[i]->getStartNodeID();
+        endNodeID = adjacency.edges[i]->getEndNodeID();
+    } else if (adjacency.edgeIDs) {
+        startNodeID = csr.edgeStarts[adjacency.edgeIDs[i]];
+        endNodeID = csr.edgeEnds[adjacency.edgeIDs[i]];
+    } else {
+        startNodeID = adjacency.nodeID;
+        endNodeID = adjacency.target(i);
+    }
+
+    return TreeEdge{startNodeID, endNodeID, adjacency.weight(i)};
+}
 
-    list<int> queue;
-    queue.push_back(nodeID);
+/**
+ * @brief Prints neighbors in the adjacency list all the nodes
+ * 
+ */
+void GraphApp::printNeighbors() {
+    for (Node * node : nodes){
+        *out << node->getName();
+        *out << " neighbors: ";
+        for (int neighbor : node->getNeighbors()) {
+            *out << nodes[neighbor]->getName() << " ";
+        }
+        *out << '\n';
+    }
+}
 
-    int currentNodeID;
+/**
+ * @brief Prints all edges elements
+ * 
+ */
+void GraphApp::printEdges() {
+    for (size_t i = 0; i < nodes.size(); i++) {
+        *out << "Edges from node: " << nodes[i]->getName() << '\n'; 
+        for (Edge * edge : edges[i]){
+            *out << nodes[edge->getStartNodeID()]->getName() << "-";
+            *out << edge->getWeight() << "-";
+            *out << nodes[edge->getEndNodeID()]->getName();
+            *out << '\n';
+        }
+    }
+}
 
-    while(!queue.empty()) {
-        currentNodeID = queue.front();
-            
-        if (kUndirected) {
-            if (command == CC) {
-                cout << currentNodeID << " ";
+/**
+ * @brief Traverses the graph in Depth-First search from a node, calling the
+ * hooks of the visitor. The traversal keeps its own stack, so the depth
+ * of the graph is not limited by the native call stack.
+ * 
+ * @param nodeID: starting node for the traversal
+ * @param visitor: hooks run at each discovered node and examined edge
+ * @tparam Policy: graph features of the product
+ * @return true if the visitor stopped the traversal
+ */
+template <class Policy, class Visitor>
+bool GraphApp::DFS(int nodeID, Visitor& visitor) {
+    dfsStack.clear();
+    visited.set(nodeID);
+    visitor.discover(nodeID, -1);
+    STAT_ADD(nodesVisited, 1);
+    dfsStack.push_back(DFSFrame{nodeID, -1, 0});
+
+    while (!dfsStack.empty()) {
+        int currentNodeID = dfsStack.back().nodeID;
+        int currentParent = dfsStack.back().parent;
+        int i = dfsStack.back().next;
+        bool descended = false;
+
+        AdjacencyRow adjacency = row<Policy>(currentNodeID);
+        while (i < adjacency.size && !descended) {
+            int next = adjacency.target<Policy>(i++);
+            bool seen = visited.test(next);
+            STAT_ADD(edgesVisited, 1);
+
+            if (visitor.examineEdge(currentNodeID, currentParent, next, seen)) {
+                return true;
+            }
+            if (!seen) {
+                dfsStack.back().next = i;
+                visited.set(next);
+                visitor.discover(next, currentNodeID);
+                STAT_ADD(nodesVisited, 1);
+                dfsStack.push_back(DFSFrame{next, currentNodeID, 0});
+                descended = true;
             }
         }
 
-        queue.pop_front();
-        
-        if (kWeighted) {
-            for (Edge* edge : edges[currentNodeID]) {
-                int endNodeID = edge->getEndNodeID();
-                if (kDirected) {
-                    if (visited[endNodeID] == false) {
-                        visited[endNodeID] = true;
-                        queue.push_back(endNodeID);
-                    }
-                }
+        // All neighbors explored: the node is finished
+        if (!descended) {
+            visitor.finish(currentNodeID);
+            dfsStack.pop_back();
+        }
+    }
+    return false;
 
-                if (kUndirected) {
-                    int startNodeID = edge->getStartNodeID();
-                    if (startNodeID != nodeID && visited[startNodeID] == false) {
-                        visited[startNodeID] = true;
-                        queue.push_back(startNodeID);
-                    } else if (endNodeID != nodeID && visited[endNodeID] == false) {
-                        visited[endNodeID] = true;
-                        queue.push_back(endNodeID);
-                    }
-                }
+}
 
+/**
+ * @brief Traverses the graph in Breadth-First search from a node, calling
+ * the hooks of the visitor
+ * 
+ * @param nodeID: starting node for the traversal
+ * @param visitor: hooks run at each discovered node and examined edge
+ * @tparam Policy: graph features of the product
+ * @return true if the visitor stopped the traversal
+ */
+template <class Policy, class Visitor>
+bool GraphApp::BFS(int nodeID, Visitor& visitor) {
+    visited.set(nodeID);
+    visitor.discover(nodeID, -1);
+    STAT_ADD(nodesVisited, 1);
+
+    // The queue is a reused vector read from a moving head, so a traversal
+    // does not allocate once the vector has grown to the component size
+    bfsQueue.clear();
+    bfsQueue.emplace_back(nodeID, -1);
+
+    for (size_t head = 0; head < bfsQueue.size(); head++) {
+        int currentNodeID = bfsQueue[head].first;
+        int currentParent = bfsQueue[head].second;
+
+        AdjacencyRow adjacency = row<Policy>(currentNodeID);
+        for (int i = 0; i < adjacency.size; i++) {
+            int next = adjacency.target<Policy>(i);
+            bool seen = visited.test(next);
+            STAT_ADD(edgesVisited, 1);
+
+            if (visitor.examineEdge(currentNodeID, currentParent, next, seen)) {
+                return true;
             }
-        }
-        
-        if (!kWeighted){
-            for (int neighborID : nodes[currentNodeID]->getNeighbors()) {
-                if (visited[neighborID] == false) {
-                    visited[neighborID] = true;
-                    queue.push_back(neighborID);
-                }
+            if (!seen) {
+                visited.set(next);
+                visitor.discover(next, currentNodeID);
+                STAT_ADD(nodesVisited, 1);
+                bfsQueue.emplace_back(next, currentNodeID);
             }
         }
+        visitor.finish(currentNodeID);
+    }
+    return false;
+}
+
+/**
+ * @brief Prints how many nodes are reachable from a node and how far the
+ * farthest one is. Runs a parallel direction-optimizing BFS on the frozen
+ * graph; bottom-up sweeps read the reverse graph.
+ * 
+ * @param startNodeName 
+ */
+void GraphApp::breadthFirstSearch(string startNodeName) {
+    indexNames();
+    int startNodeID = nameIndex.find(startNodeName);
+    if (startNodeID == -1) {
+        *out << "Node not found!" << '\n';
+        return;
     }
-    
 
+    freezeGraph();
+    int levels = levelSearch.run(csr, reverseGraph(), startNodeID, threadCount);
+    STAT_ADD(nodesVisited, levelSearch.getReachedCount());
+    *out << "Reached " << levelSearch.getReachedCount() << " of " << csr.getNodeCount() << " nodes" << '\n';
+    *out << "Maximum distance: " << levels - 1 << '\n';
 }
 
 /**
- * @brief Clears the visited map by assigning false to all position
+ * @brief Clears the visited and recursion stack sets in constant time
  * 
  */
 void GraphApp::clearVisited() {
-    //reset visited map
-    for (Node *node : nodes) {
-        visited[node->getID()] = false;
-    }
+    visited.resize(nodeCount());
+    visited.clear();
+    recurStack.resize(nodeCount());
+    recurStack.clear();
 }
 
 /**
@@ -576,40 +892,57 @@ int GraphApp::printHeader(){
     header += "------------------------------------------------------\n";
 
     //Prints the header.
-    cout << header;
+    *out << header;
 
     //Prints the help text.
-    cout << "Sample C++ program that is used to demonstrate how a " <<
-         endl << "graph application would work. The program allows for" <<endl << "the execution of graph algorithms " <<
-         endl << endl << "Available Commands:" << endl;
+    *out << "Sample C++ program that is used to demonstrate how a " <<
+         '\n' << "graph application would work. The program allows for" <<'\n' << "the execution of graph algorithms " <<
+         '\n' << '\n' << "Available Commands:" << '\n';
     for (string command : activeCommands) {
         if (command != HELP) {
-            cout << "- " << command;
+            *out << "- " << command;
             if (command == CYCLE) {
-                cout << ": Checks whether the graph include cycles." << endl;
+                *out << ": Checks whether the graph include cycles." << '\n';
             } else if (command == CC) {
-                cout << ": Computes the connected components" << 
-                endl << "of an undirected graph, which are equivalence classes under" << 
-                endl <<"the reachable-from relation." <<
-                endl;  
+                *out << ": Computes the connected components" << 
+                '\n' << "of an undirected graph, which are equivalence classes under" << 
+                '\n' <<"the reachable-from relation." <<
+                '\n';  
+            } else if (command == CONNECTED) {
+                *out << ": Checks whether two nodes are in the same component." << '\n';
+            } else if (command == COMPONENTCOUNT) {
+                *out << ": Prints the number of connected components." << '\n';
             } else if (command == SCC) {
-                cout << ": Computes the strongly connected " << 
-                endl <<"components of a directed graph, which are equivalence" << 
-                endl <<"classes under the reachable-from relation." << endl;
+                *out << ": Computes the strongly connected " << 
+                '\n' <<"components of a directed graph, which are equivalence" << 
+                '\n' <<"classes under the reachable-from relation." << '\n';
             } else if (command == PRIM) {
-                cout << ": Computes a Minimum Spanning Tree (MST) using Prim's Algorithm." << endl;
+                *out << ": Computes a Minimum Spanning Tree (MST) using Prim's Algorithm." << '\n';
+            } else if (command == KRUSKAL) {
+                *out << ": Computes a Minimum Spanning Tree (MST) using Kruskal's Algorithm." << '\n';
+            } else if (command == SHORTESTPATH) {
+                *out << ": Finds the shortest path between two nodes." << '\n';
+            } else if (command == BFSEARCH) {
+                *out << ": Computes the BFS distance from a node to every node." << '\n';
             } else if (command == ADDNODE) {
-                cout << ": Adds a new node to the graph." << endl;
+                *out << ": Adds a new node to the graph." << '\n';
             } else if (command == ADDEDGE) {
-                cout << ": Adds a new edge to the graph." << endl;
+                *out << ": Adds a new edge to the graph." << '\n';
             } else if (command == UPDATENODE) {
-                cout << ": Updates the name of a specific node." << endl;
+                *out << ": Updates the name of a specific node." << '\n';
             } else if (command == UPDATEEDGE) {
-                cout << ": Updates the weight of a specific edge." << endl;
+                *out << ": Updates the weight of a specific edge." << '\n';
             } else if (command == PRINTGRAPH) {
-                cout << ": Print all nodes and edges." << endl;
+                *out << ": Print all nodes and edges." << '\n';
+            } else if (command == SAVESNAPSHOT) {
+                *out << ": Saves the graph to a binary snapshot file." << '\n';
+            } else if (command == STATS) {
+                *out << ": Prints the time and work of every command run so far." << '\n';
+            } else if (command == SAVESTATS) {
+                *out << ": Saves the command statistics as JSON, or as Prometheus" <<
+                '\n' << "text if the file name ends in .prom." << '\n';
             } else if (command == EXIT) {
-                cout << ": Exits the program." << endl;
+                *out << ": Exits the program." << '\n';
             }
         }
     }
@@ -618,129 +951,597 @@ int GraphApp::printHeader(){
 }
 
 /**
- * @brief Traverses the graph looking for cycles. It requires kDFS
+ * @brief Traverses the graph looking for cycles. It requires kDFS.
+ * The DFS kernel is instantiated for the configured graph features.
  * 
  * @return true if the graph has cycles
  * @return false if the graph doesn't have cycles
  */
 bool GraphApp::isCyclic() {
-    //reset visited map
     if (kDFS) {
+        // Directed graphs that are being edited keep a topological order
+        if (kDirected && topoReady) {
+            return topoCyclic;
+        }
+
+        prepareStorage();
         clearVisited();
-        for (Node * node : nodes) {
-            if(visited[node->getID()] == false){
-                if (DFS(node->getID(), -1, CYCLE)) {
-                    return true;
+        return dispatchPolicy(kWeighted, kDirected, kCSR, [&](auto policy) {
+            using Policy = decltype(policy);
+            CycleVisitor<Policy> visitor(recurStack);
+            for (int nodeID = 0; nodeID < nodeCount(); nodeID++) {
+                if(!visited.test(nodeID)){
+                    if (DFS<Policy>(nodeID, visitor)) {
+                        return true;
+                    }
                 }
             }
-        }
-        return false;
+            return false;
+        });
     } else {
-        cout << "DFS not enabled!" << endl;
+        *out << "DFS not enabled!" << '\n';
         return false;
     }
     
 }
 
 /**
- * @brief Traverses the graph printing the connected components
+ * @brief Orders the nodes of a directed graph topologically, once. Later
+ * edge insertions update the order with orderEdge.
  * 
  */
-void GraphApp::connectedComponents() {
-    if ((kBFS || kDFS) && kUndirected) {
-        clearVisited();
-        int compNum = 0;
-        for (Node * node : nodes) {
-            if(visited[node->getID()] == false){
-                cout << "Component " << compNum+1 << ": ";
-                if (kDFS) {
-                    DFS(node->getID(), 0, CC);;
-                }
+void GraphApp::updateTopoOrder() {
+    if (!topoReady) {
+        freezeGraph();
+        topoCyclic = !topoOrder.build(csr.getNodeCount(), csr.edgeStarts, csr.edgeEnds);
+        topoReady = true;
+    }
+}
 
-                if (kBFS) {
-                    BFS(node->getID(), CC);
-                }
-                cout << endl;
-                compNum++;
-            }
-        }
-    } else {
-        cout << "Feature not enabled!" << endl;
+/**
+ * @brief Orders a directed graph loaded with kAcyclic. A loaded graph that
+ * already has a cycle cannot be kept acyclic, so kAcyclic is turned off
+ * instead of admitting edges without checking them.
+ * 
+ */
+void GraphApp::checkAcyclic() {
+    if (!kDirected || !kAcyclic) {
+        return;
+    }
+    updateTopoOrder();
+    if (topoCyclic) {
+        kAcyclic = false;
+        *out << "Graph contains cycle! Acyclic mode disabled" << '\n';
     }
 }
 
 /**
- * @brief Find the Minimum Spanning Tree of the Graph using Prim's Algorithm
+ * @brief Updates the topological order with a new directed edge. Edges
+ * that would close a cycle are rejected with kAcyclic; otherwise the
+ * graph is marked cyclic and the order is dropped, since edges are never
+ * removed.
  * 
+ * @param startNodeID 
+ * @param endNodeID 
+ * @return true if the edge can be added
+ * @return false if kAcyclic rejects the edge
  */
-void GraphApp::MSTPrim() {
-    if (kWeighted && kUndirected) {
-        vector<Edge*> MST;
-        
+bool GraphApp::orderEdge(int startNodeID, int endNodeID) {
+    if (!topoReady || topoCyclic || topoOrder.addEdge(startNodeID, endNodeID)) {
+        return true;
+    }
+    return closeCycle();
+}
+
+/**
+ * @brief Handles an edge that closes a cycle: kAcyclic rejects it,
+ * otherwise the graph is marked cyclic
+ * 
+ * @return true if the edge can be added
+ * @return false if kAcyclic rejects the edge
+ */
+bool GraphApp::closeCycle() {
+    if (kAcyclic) {
+        *out << "Edge would create a cycle!" << '\n';
+        return false;
+    }
+
+    topoCyclic = true;
+    topoOrder.clear();
+    *out << "Graph contains cycle!" << '\n';
+    return true;
+}
+
+/**
+ * @brief Checks a new edge against the topological order and creates its
+ * endpoints once it is accepted, so a rejected edge leaves no new nodes
+ * behind
+ * 
+ * @param startNodeName 
+ * @param endNodeName 
+ * @param startNodeID: receives the ID of the start node
+ * @param endNodeID: receives the ID of the end node
+ * @return true if the edge can be added
+ * @return false if kAcyclic rejects the edge
+ */
+bool GraphApp::admitEdge(const string& startNodeName, const string& endNodeName, int& startNodeID, int& endNodeID) {
+    if (kDirected && (kCycle || kAcyclic)) {
+        updateTopoOrder();
+    }
+
+    startNodeID = nameIndex.find(startNodeName);
+    endNodeID = nameIndex.find(endNodeName);
+    if (startNodeID != -1 && endNodeID != -1) {
+        return orderEdge(startNodeID, endNodeID);
+    }
+
+    // A node that doesn't exist yet has no edges, so it can only close a
+    // cycle with a self-loop
+    if (startNodeName == endNodeName && topoReady && !topoCyclic && !closeCycle()) {
+        return false;
+    }
+    startNodeID = internNode(startNodeName);
+    endNodeID = internNode(endNodeName);
+    return orderEdge(startNodeID, endNodeID);
+}
+
+/**
+ * @brief Prints the connected components of an undirected graph, listed in
+ * the order of their smallest node ID. Components are kept up to date by
+ * add node and add edge once they have been computed, so only the first
+ * query traverses the graph.
+ * 
+ */
+void GraphApp::connectedComponents() {
+    if ((kBFS || kDFS) && kUndirected) {
+        vector<int> labels;
+        int componentCount;
+        if (componentsReady) {
+            // Label every node by the position of the first node of its set
+            labels.resize(nodeCount());
+            vector<int> rootLabels(nodeCount(), -1);
+            componentCount = 0;
+            for (int u = 0; u < nodeCount(); u++) {
+                int root = componentSets.find(u);
+                if (rootLabels[root] == -1) {
+                    rootLabels[root] = componentCount++;
+                }
+                labels[u] = rootLabels[root];
+            }
+        } else {
+            componentCount = computeComponents(labels);
+        }
+        printComponents(labels, componentCount);
+    } else {
+        *out << "Feature not enabled!" << '\n';
+    }
+}
+
+/**
+ * @brief Labels the connected components from scratch and seeds the
+ * disjoint sets that later edits update. With several threads they are
+ * labeled in parallel on the frozen graph; on one thread a DFS or BFS
+ * labels them with a ComponentVisitor.
+ * 
+ * @param labels: receives the component of every node
+ * @return int: number of components
+ */
+int GraphApp::computeComponents(vector<int>& labels) {
+    int componentCount;
+    if (threadCount > 1) {
+        freezeGraph();
+        componentCount = ccFinder.compute(csr, threadCount);
+        STAT_ADD(nodesVisited, csr.getNodeCount());
+        labels = ccFinder.getComponents();
+    } else {
+        prepareStorage();
         clearVisited();
-        
-        // Initialize node values
-        for (int i=0; i < nodes.size(); i++){
-            if (i == 0){
-                nodes[i]->setValue(0);
-            } else {
-                nodes[i]->setValue(INT_MAX);
+        labels.assign(nodeCount(), 0);
+        ComponentVisitor visitor(labels);
+        dispatchPolicy(kWeighted, false, kCSR, [&](auto policy) {
+            using Policy = decltype(policy);
+            for (int nodeID = 0; nodeID < nodeCount(); nodeID++) {
+                if (!visited.test(nodeID)) {
+                    if (kDFS) {
+                        DFS<Policy>(nodeID, visitor);
+                    } else {
+                        BFS<Policy>(nodeID, visitor);
+                    }
+                    visitor.component++;
+                }
             }
+        });
+        componentCount = visitor.component;
+    }
+
+    vector<int> firstNodes(componentCount, -1);
+    componentSets.reset(nodeCount());
+    for (int u = 0; u < nodeCount(); u++) {
+        if (firstNodes[labels[u]] == -1) {
+            firstNodes[labels[u]] = u;
+        } else {
+            componentSets.unite(firstNodes[labels[u]], u);
         }
+    }
+    componentsReady = true;
+    return componentCount;
+}
 
-        int currentNodeID = 0;
-        visited[currentNodeID] = true;
-        int count = 1;
-        int next;
-        int total = 0;
+/**
+ * @brief Computes the connected components if they are not up to date
+ * 
+ */
+void GraphApp::updateComponents() {
+    if (!componentsReady) {
+        vector<int> labels;
+        computeComponents(labels);
+    }
+}
 
-        while (count < nodes.size()) {
-            int min = INT_MAX;
-            int minIndex;
-            Edge * minEdge;
-            for (Node * node : nodes) {
-                currentNodeID = node->getID();
-                if (visited[currentNodeID]) {
-                    for (Edge * edge : edges[currentNodeID]) {
-                        
-                        next = edge->getNext(currentNodeID);
+/**
+ * @brief Prints whether two nodes are in the same connected component
+ * 
+ * @param startNodeName 
+ * @param endNodeName 
+ */
+void GraphApp::checkConnected(string startNodeName, string endNodeName) {
+    if (!((kBFS || kDFS) && kUndirected)) {
+        *out << "Feature not enabled!" << '\n';
+        return;
+    }
 
-                        if(visited[next] == false && edge->getWeight() < nodes[next]->getValue()) {
-                            nodes[next]->setValue(edge->getWeight());
+    indexNames();
+    int startNodeID = nameIndex.find(startNodeName);
+    int endNodeID = nameIndex.find(endNodeName);
+    if (startNodeID == -1 || endNodeID == -1) {
+        *out << "Node not found!" << '\n';
+        return;
+    }
+
+    updateComponents();
+    if (componentSets.connected(startNodeID, endNodeID)) {
+        *out << startNodeName << " and " << endNodeName << " are connected" << '\n';
+    } else {
+        *out << startNodeName << " and " << endNodeName << " are not connected" << '\n';
+    }
+}
+
+/**
+ * @brief Prints the strongly connected components of a directed graph.
+ * Components are computed on the frozen graph with an iterative Tarjan
+ * search and listed in the order of their smallest node ID.
+ * 
+ */
+void GraphApp::stronglyConnectedComponents() {
+    if (kDFS && kDirected) {
+        freezeGraph();
+        int componentCount = sccFinder.compute(csr);
+        STAT_ADD(nodesVisited, csr.getNodeCount());
+        STAT_ADD(edgesVisited, csr.targets.size());
+
+        printComponents(sccFinder.getComponents(), componentCount);
+    } else {
+        *out << "Feature not enabled!" << '\n';
+    }
+}
+
+/**
+ * @brief Lists the nodes of every component, ordering components by their
+ * smallest node. The text is formatted into one buffer and written at
+ * once, so large graphs are not slowed down by stream calls per node.
+ * 
+ * @param components: component of every node
+ * @param componentCount 
+ */
+void GraphApp::printComponents(const vector<int>& components, int componentCount) {
+    // Renumber components by their smallest node and group their nodes
+    vector<int> order(componentCount, -1);
+    vector<int> offsets(componentCount + 1, 0);
+    int next = 0;
+    for (int u = 0; u < (int)components.size(); u++) {
+        if (order[components[u]] == -1) {
+            order[components[u]] = next++;
+        }
+        offsets[order[components[u]] + 1]++;
+    }
+    for (int c = 0; c < componentCount; c++) {
+        offsets[c + 1] += offsets[c];
+    }
+    vector<int> members(components.size());
+    vector<int> cursor(offsets.begin(), offsets.end() - 1);
+    for (int u = 0; u < (int)components.size(); u++) {
+        members[cursor[order[components[u]]]++] = u;
+    }
+
+    string text;
+    char number[16];
+    for (int c = 0; c < componentCount; c++) {
+        text += "Component ";
+        text.append(number, to_chars(number, number + sizeof(number), c + 1).ptr);
+        text += ": ";
+        for (int i = offsets[c]; i < offsets[c + 1]; i++) {
+            text.append(number, to_chars(number, number + sizeof(number), members[i]).ptr);
+            text += ' ';
+        }
+        text += '\n';
+    }
+    *out << text;
+}
+
+/**
+ * @brief Find the Minimum Spanning Tree of the Graph using Prim's Algorithm.
+ * Nodes on the frontier are kept in an indexed heap keyed by the lightest
+ * edge that reaches them, so the search runs in O(E log V). A disconnected
+ * graph gets a minimum spanning forest, one tree per component. The
+ * result is kept and repaired by add edge and update edge, so later
+ * queries only print it.
+ * 
+ */
+void GraphApp::MSTPrim() {
+    if (kWeighted && kUndirected) {
+        if (!mstReady) {
+            prepareStorage();
+
+            // MST edges as (node, position in the node's adjacency row)
+            vector<pair<int, int>> MST;
+            vector<pair<int, int>> parentEdge(nodeCount(), make_pair(-1, -1));
+
+            clearVisited();
+            primHeap.resize(nodeCount());
+            primHeap.clear();
+
+            dispatchPolicy(true, false, kCSR, [&](auto policy) {
+                using Policy = decltype(policy);
+                for (int root = 0; root < nodeCount(); root++) {
+                    if (visited.test(root)) {
+                        continue;
+                    }
+
+                    primHeap.pushOrDecrease(root, 0);
+
+                    while (!primHeap.empty()) {
+                        int currentNodeID = primHeap.pop();
+                        visited.set(currentNodeID);
+                        STAT_ADD(nodesVisited, 1);
+
+                        if (parentEdge[currentNodeID].first != -1) {
+                            MST.push_back(parentEdge[currentNodeID]);
                         }
 
-                        if(visited[next] == false && nodes[next]->getValue() < min) {
-                            min = nodes[next]->getValue();
-                            minIndex = next;
-                            minEdge = edge;
+                        AdjacencyRow adjacency = row<Policy>(currentNodeID);
+                        STAT_ADD(edgesVisited, adjacency.size);
+                        for (int i = 0; i < adjacency.size; i++) {
+                            int next = adjacency.target<Policy>(i);
+
+                            if (!visited.test(next) && primHeap.pushOrDecrease(next, adjacency.weight<Policy>(i))) {
+                                parentEdge[next] = make_pair(currentNodeID, i);
+                            }
                         }
                     }
                 }
+            });
+
+            vector<TreeEdge> treeEdges;
+            treeEdges.reserve(MST.size());
+            for (pair<int, int> edge : MST) {
+                treeEdges.push_back(rowEdge(row(edge.first), edge.second));
             }
-            
+            mstCache.build(nodeCount(), treeEdges);
+            mstReady = true;
+        }
 
-            visited[minIndex] = true;
-            total += min;
+        *out << "MST edges:" << '\n';
+        for (const TreeEdge& edge : mstCache.getEdges()) {
+            if (edge.startNodeID != -1) {
+                *out << nodeName(edge.startNodeID) << "-";
+                *out << edge.weight << "-";
+                *out << nodeName(edge.endNodeID);
+                *out << '\n';
+            }
+        }
 
-            MST.push_back(minEdge);
+        if (mstCache.getTreeCount() > 1) {
+            *out << "Spanning trees: " << mstCache.getTreeCount() << '\n';
+        }
+        *out << "Total MST weight: " << mstCache.getTotalWeight() << '\n';
+    } else {
+        *out << "Feature not enabled!" << '\n';
+    }
+}
 
-            count++;
+/**
+ * @brief Repairs the cached MST after the weight of an edge from
+ * startNodeID to endNodeID changed. A lighter edge is checked against the
+ * heaviest edge on the tree path between its endpoints. A heavier tree
+ * edge is cut out and the lightest edge across the cut takes its place;
+ * only the edges of the smaller side of the cut are scanned.
+ * 
+ * @param startNodeID 
+ * @param endNodeID 
+ * @param newWeight 
+ */
+void GraphApp::repairMST(int startNodeID, int endNodeID, int newWeight) {
+    int slot = mstCache.findEdge(startNodeID, endNodeID);
+    if (slot == -1) {
+        mstCache.insertEdge(startNodeID, endNodeID, newWeight);
+        return;
+    }
+
+    int oldWeight = mstCache.edge(slot).weight;
+    mstCache.setWeight(slot, newWeight);
+    if (newWeight <= oldWeight) {
+        return;
+    }
+
+    vector<int> side;
+    mstCache.cut(slot, side);
+    Edge* lightest = nullptr;
+    for (int u : side) {
+        STAT_ADD(edgesVisited, edges[u].size());
+        for (Edge* edge : edges[u]) {
+            if (!mstCache.inSide(edge->getNext(u)) && (!lightest || edge->getWeight() < lightest->getWeight())) {
+                lightest = edge;
+            }
         }
+    }
+
+    if (lightest) {
+        mstCache.link(lightest->getStartNodeID(), lightest->getEndNodeID(), lightest->getWeight());
+    }
+}
+
+/**
+ * @brief Sorts edge indices by weight with a stable LSD radix sort over
+ * the four bytes of the weight. Passes where every key has the same byte
+ * are skipped, so small weights only cost one or two passes. Every pass
+ * counts and scatters blocks of edges in parallel; each block writes
+ * after the blocks before it, so the sort stays stable.
+ * 
+ * @param weights: weight of every edge
+ * @param order: receives the edge indices in non-decreasing weight order
+ */
+void GraphApp::sortEdgesByWeight(ArrayView<int> weights, vector<int>& order) {
+    int edgeCount = (int)weights.size();
+    order.resize(edgeCount);
+    for (int e = 0; e < edgeCount; e++) {
+        order[e] = e;
+    }
+
+    int blocks = max(1, min(threadCount * 4, edgeCount / 65536 + 1));
+    vector<size_t> counts((size_t)blocks * 256);
+    vector<int> buffer(edgeCount);
+    for (int shift = 0; shift < 32; shift += 8) {
+        parallelFor(blocks, threadCount, [&](int b) {
+            size_t* count = &counts[(size_t)b * 256];
+            fill(count, count + 256, 0);
+            for (int i = (int)((long long)edgeCount * b / blocks); i < (long long)edgeCount * (b + 1) / blocks; i++) {
+                // Flipping the sign bit makes negative weights sort first
+                uint32_t key = (uint32_t)weights[order[i]] ^ 0x80000000u;
+                count[(key >> shift) & 0xFF]++;
+            }
+        });
+
+        bool singleBucket = false;
+        size_t position = 0;
+        for (int digit = 0; digit < 256; digit++) {
+            size_t start = position;
+            for (int b = 0; b < blocks; b++) {
+                size_t count = counts[(size_t)b * 256 + digit];
+                counts[(size_t)b * 256 + digit] = position;
+                position += count;
+            }
+            if (position - start == (size_t)edgeCount) {
+                singleBucket = true;
+            }
+        }
+        if (singleBucket) {
+            continue;
+        }
+
+        parallelFor(blocks, threadCount, [&](int b) {
+            size_t* cursor = &counts[(size_t)b * 256];
+            for (int i = (int)((long long)edgeCount * b / blocks); i < (long long)edgeCount * (b + 1) / blocks; i++) {
+                uint32_t key = (uint32_t)weights[order[i]] ^ 0x80000000u;
+                buffer[cursor[(key >> shift) & 0xFF]++] = order[i];
+            }
+        });
+        order.swap(buffer);
+    }
+}
+
+/**
+ * @brief Find the Minimum Spanning Tree of the Graph using Kruskal's Algorithm.
+ * Edges of the frozen graph are radix sorted by weight and added in order
+ * unless a disjoint set shows their endpoints are already connected.
+ * A disconnected graph gets a minimum spanning forest.
+ * 
+ */
+void GraphApp::MSTKruskal() {
+    if (kWeighted && kUndirected) {
+        freezeGraph();
+
+        vector<int> order;
+        sortEdgesByWeight(csr.edgeWeights, order);
+
+        DisjointSet components(nodeCount());
+        vector<int> MST;
+        long long total = 0;
 
-        cout << "MST edges:" << endl;
-        for (Edge * edge : MST){
-            cout << nodes[edge->getStartNodeID()]->getName() << "-";
-            cout << edge->getWeight() << "-";
-            cout << nodes[edge->getEndNodeID()]->getName();
-            cout << endl;
+        for (int e : order) {
+            if (components.getSetCount() == 1) {
+                break;
+            }
+            STAT_ADD(edgesVisited, 1);
+            if (components.unite(csr.edgeStarts[e], csr.edgeEnds[e])) {
+                MST.push_back(e);
+                total += csr.edgeWeights[e];
+            }
         }
 
-        cout << "Total MST weight: " << total << endl;
+        *out << "MST edges:" << '\n';
+        for (int e : MST){
+            *out << nodeName(csr.edgeStarts[e]) << "-";
+            *out << csr.edgeWeights[e] << "-";
+            *out << nodeName(csr.edgeEnds[e]);
+            *out << '\n';
+        }
+
+        if (components.getSetCount() > 1) {
+            *out << "Spanning trees: " << components.getSetCount() << '\n';
+        }
+        *out << "Total MST weight: " << total << '\n';
     } else {
-        cout << "Feature not enabled!" << endl;
+        *out << "Feature not enabled!" << '\n';
     }
 }
 
+/**
+ * @brief Prints the shortest path between two nodes. Weighted graphs use a
+ * bidirectional Dijkstra search, unweighted graphs a BFS. The search
+ * workspace is reused between queries.
+ * 
+ * @param startNodeName 
+ * @param endNodeName 
+ */
+void GraphApp::findShortestPath(string startNodeName, string endNodeName) {
+    indexNames();
+    int startNodeID = nameIndex.find(startNodeName);
+    int endNodeID = nameIndex.find(endNodeName);
+    if (startNodeID == -1 || endNodeID == -1) {
+        *out << "Node not found!" << '\n';
+        return;
+    }
+
+    freezeGraph();
+
+    long long distance;
+    if (kWeighted) {
+        if (csr.hasNegativeWeights()) {
+            *out << "Shortest path requires non-negative weights!" << '\n';
+            return;
+        }
+        distance = shortestPath.bidirectional(csr, reverseGraph(), startNodeID, endNodeID);
+    } else {
+        distance = shortestPath.BFS(csr, startNodeID, endNodeID);
+    }
+
+    if (distance == ShortestPath::UNREACHABLE) {
+        *out << "No path from " << startNodeName << " to " << endNodeName << '\n';
+        return;
+    }
+
+    *out << "Shortest path: ";
+    vector<int> path = shortestPath.path();
+    for (size_t i = 0; i < path.size(); i++) {
+        if (i > 0) {
+            *out << "-";
+        }
+        *out << nodeName(path[i]);
+    }
+    *out << '\n';
+    *out << "Total distance: " << distance << '\n';
+}
+
 /**
  * @brief Runs the main portion of the program.
  *        Takes in commands from the user and
@@ -755,93 +1556,427 @@ void GraphApp::handleCommands() {
     //Iterate until the stop command is reached.
     bool iterate = true;
     while(iterate){
-        // TODO: Add variable that receives the result of the functions being called
-        // TODO: Add the possibility of loading graph from file and have multiple graphs
         //Places a new line.
-        cout << endl;
+        *out << '\n';
 
         //Prompt for input.
-        cout << "> ";
-        getline(cin, command);
-
-        //Check commands
-        if (command == HELP){
-            printHeader();
-        } else if (command == CYCLE) {
-            if (kCycle) {
-                if (isCyclic()) {
-                    cout << "Graph contains cycle!" << endl;
-                } else {
-                    cout << "Graph doesn't contain cycle" << endl;
-                }
-            } else {
-                cout << "Feature not enabled!" << endl;
+        *out << "> ";
+        if (!getline(cin, command)) {
+            break;
+        }
+
+        iterate = runCommand(command);
+    }
+    out->flush();
+}
+
+/**
+ * @brief Runs the commands of a script, one per line, with their
+ * arguments on the same line (e.g. "add edge A B 5"). Prompts are not
+ * printed and the output goes through one large buffer.
+ * 
+ * @param scriptFilename: "-" reads the commands from the standard input
+ */
+void GraphApp::runScript(string scriptFilename) {
+    MappedFile script;
+    if (scriptFilename != "-" && !script.open(scriptFilename, true)) {
+        *out << "Unable to open script" << '\n';
+        return;
+    }
+
+    // Output to stdout is buffered for the script; an output file already is
+    out->flush();
+    OutputBuffer buffer(STDOUT_FILENO);
+    ostream bufferedOut(&buffer);
+    ostream* previousOut = out;
+    if (out == &cout) {
+        out = &bufferedOut;
+    }
+    batchMode = true;
+
+    if (scriptFilename == "-") {
+        string line;
+        while (getline(cin, line) && runCommand(line)) {
+        }
+    } else {
+        const char* cursor = script.data();
+        while (cursor < script.end()) {
+            const char* newline = EdgeListParser::findNewline(cursor, script.end());
+            string_view line(cursor, newline - cursor);
+            cursor = newline + 1;
+            if (!runCommand(line)) {
+                break;
             }
-        } else if (command == CC) {
-            if (kConnectedComps) {
-                connectedComponents();
+        }
+    }
+
+    bufferedOut.flush();
+    out = previousOut;
+    batchMode = false;
+}
+
+/**
+ * @brief Returns the longest command name that the line starts with, and
+ * the text after it, or an empty string if no command matches
+ * 
+ * @param line 
+ * @param arguments: receives the text after the command name
+ * @return std::string 
+ */
+string GraphApp::matchCommand(string_view line, string_view& arguments) {
+    const string* commands[] = {&HELP, &CYCLE, &CC, &CONNECTED, &COMPONENTCOUNT, &SCC, &PRIM, &KRUSKAL, &SHORTESTPATH, &BFSEARCH,
+        &ADDNODE, &ADDEDGE, &UPDATENODE, &UPDATEEDGE, &PRINTGRAPH, &SAVESNAPSHOT, &STATS, &SAVESTATS, &EXIT};
+
+    const string* best = nullptr;
+    for (const string* command : commands) {
+        if (line.substr(0, command->size()) == *command &&
+            (line.size() == command->size() || line[command->size()] == ' ' || line[command->size()] == '\t') &&
+            (!best || command->size() > best->size())) {
+            best = command;
+        }
+    }
+
+    if (!best) {
+        return "";
+    }
+    arguments = line.substr(best->size());
+    return *best;
+}
+
+/**
+ * @brief Returns the next argument of the current command. Arguments on
+ * the command line are used first; when they run out, interactive mode
+ * prompts for the value and batch mode fails.
+ * 
+ * @param prompt 
+ * @param value 
+ * @return true 
+ * @return false if a batch command is missing an argument
+ */
+bool GraphApp::readArgument(const string& prompt, string& value) {
+    if (nextArgument < commandArguments.size()) {
+        value = string(commandArguments[nextArgument++]);
+        return true;
+    }
+    if (batchMode) {
+        *out << "Missing argument!" << '\n';
+        return false;
+    }
+
+    *out << prompt << '\n';
+    return (bool)getline(cin, value);
+}
+
+/**
+ * @brief Reads an argument and parses it as a weight
+ * 
+ * @param prompt 
+ * @param weight 
+ * @return true 
+ * @return false if the argument is missing or not a number
+ */
+bool GraphApp::readWeight(const string& prompt, int& weight) {
+    string text;
+    if (!readArgument(prompt, text)) {
+        return false;
+    }
+    if (!EdgeListParser::parseInt(text, weight)) {
+        *out << "Invalid weight!" << '\n';
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Drops the results that edits keep up to date, so the next query
+ * computes them from the graph again
+ * 
+ */
+void GraphApp::resetDerivedState() {
+    componentsReady = false;
+    topoReady = false;
+    topoCyclic = false;
+    mstReady = false;
+}
+
+/**
+ * @brief Runs one command line. The command name may be followed by its
+ * arguments, separated by whitespace.
+ * 
+ * @param line 
+ * @return true 
+ * @return false if the command was the exit command
+ */
+bool GraphApp::runCommand(string_view line) {
+    if (!line.empty() && line.back() == '\r') {
+        line.remove_suffix(1);
+    }
+
+    string_view arguments;
+    string command = matchCommand(line, arguments);
+
+    string_view fields[4];
+    int fieldCount = 0;
+    EdgeListParser parser(arguments.data(), arguments.data() + arguments.size());
+    parser.nextLine(fields, 4, fieldCount);
+    if (!command.empty() && fieldCount > argumentCount(command)) {
+        *out << "Too many arguments!" << '\n';
+        return true;
+    }
+    commandArguments.assign(fields, fields + fieldCount);
+    nextArgument = 0;
+
+    if (command.empty() || command == STATS || command == SAVESTATS || command == EXIT ||
+        (!timing && !GRAPH_STATS)) {
+        return executeCached(command, line);
+    }
+
+#if GRAPH_STATS
+    commandStats.begin();
+#endif
+    auto start = chrono::steady_clock::now();
+    bool iterate = executeCached(command, line);
+    double milliseconds = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+#if GRAPH_STATS
+    commandStats.end(command, milliseconds);
+#endif
+    if (timing) {
+        cerr << command << ": " << milliseconds << " ms" << '\n';
+    }
+    return iterate;
+}
+
+/**
+ * @brief Returns the most arguments a command takes
+ * 
+ * @param command 
+ * @return int 
+ */
+int GraphApp::argumentCount(const string& command) {
+    if (command == ADDEDGE) {
+        return kWeighted ? 3 : 2;
+    } else if (command == UPDATEEDGE) {
+        return 3;
+    } else if (command == SHORTESTPATH || command == CONNECTED || command == UPDATENODE) {
+        return 2;
+    } else if (command == BFSEARCH || command == ADDNODE || command == SAVESNAPSHOT || command == SAVESTATS) {
+        return 1;
+    }
+    return 0;
+}
+
+/**
+ * @brief Returns how many arguments a read-only command takes, or -1 if
+ * the output of the command must not be cached
+ * 
+ * @param command 
+ * @return int 
+ */
+int GraphApp::cachedArgumentCount(const string& command) {
+    if (command == CYCLE || command == CC || command == COMPONENTCOUNT || command == SCC ||
+        command == PRIM || command == KRUSKAL || command == BFSEARCH || command == SHORTESTPATH ||
+        command == CONNECTED) {
+        return argumentCount(command);
+    }
+    return -1;
+}
+
+/**
+ * @brief Runs a command, replaying the output of read-only commands that
+ * already ran with the same arguments on the same graph version. Commands
+ * that would prompt for missing arguments are never cached.
+ * 
+ * @param command 
+ * @param line 
+ * @return true 
+ * @return false if the command was the exit command
+ */
+bool GraphApp::executeCached(const string& command, string_view line) {
+    int argumentCount = cachedArgumentCount(command);
+    if (!cacheResults || argumentCount < 0 || (int)commandArguments.size() < argumentCount) {
+        return executeCommand(command, line);
+    }
+
+    if (cacheVersion != graphVersion) {
+        resultCache.clear();
+        cacheVersion = graphVersion;
+    }
+
+    string key = command;
+    for (int i = 0; i < argumentCount; i++) {
+        key += '\n';
+        key += commandArguments[i];
+    }
+    auto it = resultCache.find(key);
+    if (it != resultCache.end()) {
+        *out << it->second;
+        return true;
+    }
+
+    // The output goes straight through; a copy is kept unless it
+    // outgrows the limit
+    ostream* target = out;
+    CaptureBuffer capture(target->rdbuf(), MAX_CACHED_BYTES);
+    ostream captured(&capture);
+    out = &captured;
+    bool iterate = executeCommand(command, line);
+    captured.flush();
+    out = target;
+
+    if (cacheVersion == graphVersion && capture.isComplete()) {
+        resultCache.emplace(move(key), capture.takeText());
+    }
+    return iterate;
+}
+
+/**
+ * @brief Runs a matched command, reading its arguments with readArgument
+ * 
+ * @param command: the command name, or an empty string if none matched
+ * @param line: the whole command line, for error messages
+ * @return true 
+ * @return false if the command was the exit command
+ */
+bool GraphApp::executeCommand(const string& command, string_view line) {
+    //Check commands
+    if (command == HELP){
+        printHeader();
+    } else if (command == CYCLE) {
+        if (kCycle) {
+            if (isCyclic()) {
+                *out << "Graph contains cycle!" << '\n';
             } else {
-                cout << "Feature not enabled!" << endl;
+                *out << "Graph doesn't contain cycle" << '\n';
             }
-        } else if (command == PRIM) {
-            if (kPrim) {
-                MSTPrim();
-            } else {
-                cout << "Feature not enabled!" << endl;
+        } else {
+            *out << "Feature not enabled!" << '\n';
+        }
+    } else if (command == CC) {
+        if (kConnectedComps) {
+            connectedComponents();
+        } else {
+            *out << "Feature not enabled!" << '\n';
+        }
+    } else if (command == CONNECTED) {
+        string startNodeName, endNodeName;
+        if (!kConnectedComps) {
+            *out << "Feature not enabled!" << '\n';
+        } else if (readArgument("Enter first node name: ", startNodeName) &&
+            readArgument("Enter second node name: ", endNodeName)) {
+            checkConnected(startNodeName, endNodeName);
+        }
+    } else if (command == COMPONENTCOUNT) {
+        if (kConnectedComps && (kBFS || kDFS) && kUndirected) {
+            updateComponents();
+            *out << "Components: " << componentSets.getSetCount() << '\n';
+        } else {
+            *out << "Feature not enabled!" << '\n';
+        }
+    } else if (command == SCC) {
+        if (kStronglyConnectedComps) {
+            stronglyConnectedComponents();
+        } else {
+            *out << "Feature not enabled!" << '\n';
+        }
+    } else if (command == PRIM) {
+        if (kPrim) {
+            MSTPrim();
+        } else {
+            *out << "Feature not enabled!" << '\n';
+        }
+    } else if (command == KRUSKAL) {
+        if (kKruskal) {
+            MSTKruskal();
+        } else {
+            *out << "Feature not enabled!" << '\n';
+        }
+    } else if (command == SHORTESTPATH) {
+        if (kShortestPath) {
+            string startNodeName, endNodeName;
+            if (readArgument("Enter start node name: ", startNodeName) &&
+                readArgument("Enter end node name: ", endNodeName)) {
+                findShortestPath(startNodeName, endNodeName);
             }
-        } else if (command == PRINTGRAPH) {
-            if(kWeighted) {
-                printEdges();
+        } else {
+            *out << "Feature not enabled!" << '\n';
+        }
+    } else if (command == BFSEARCH) {
+        if (kBFS) {
+            string startNodeName;
+            if (readArgument("Enter start node name: ", startNodeName)) {
+                breadthFirstSearch(startNodeName);
             }
-            if(!kWeighted) {
-                printNeighbors();
+        } else {
+            *out << "Feature not enabled!" << '\n';
+        }
+    } else if (command == PRINTGRAPH) {
+        thawGraph();
+        if(kWeighted) {
+            printEdges();
+        }
+        if(!kWeighted) {
+            printNeighbors();
+        }
+    } else if (command == SAVESNAPSHOT) {
+        string snapshotFilename;
+        if (readArgument("Enter snapshot file name: ", snapshotFilename)) {
+            saveSnapshot(snapshotFilename);
+        }
+    } else if (command == STATS || command == SAVESTATS) {
+#if GRAPH_STATS
+        string statsFilename;
+        if (command == STATS) {
+            commandStats.print(*out);
+        } else if (readArgument("Enter stats file name: ", statsFilename)) {
+            if (!commandStats.save(statsFilename)) {
+                *out << "Unable to save stats" << '\n';
             }
-        } else if (command == ADDNODE) {
-            cout << "Enter node name: " << endl;
-            string nodeName;
-            getline(cin, nodeName);
+        }
+#else
+        *out << "Feature not enabled!" << '\n';
+#endif
+    } else if (command == ADDNODE) {
+        string nodeName;
+        if (readArgument("Enter node name: ", nodeName)) {
             addNode(nodeName);
-        } else if (command == ADDEDGE) {
-            string startNodeName, endNodeName;
-            int weight;
-            cout << "Enter start node name: " << endl;
-            getline(cin, startNodeName);
-            cout << "Enter end node name: " << endl;
-            getline(cin, endNodeName);
+        }
+    } else if (command == ADDEDGE) {
+        string startNodeName, endNodeName;
+        int weight;
+        if (readArgument("Enter start node name: ", startNodeName) &&
+            readArgument("Enter end node name: ", endNodeName)) {
             if(kWeighted) {
-                cout << "Enter weight: " << endl;
-                cin >> weight;
-                addEdge(startNodeName, endNodeName, weight);
+                if (readWeight("Enter weight: ", weight)) {
+                    addEdge(startNodeName, endNodeName, weight);
+                }
             }
             if (!kWeighted) {
                 addEdge(startNodeName, endNodeName);
             }
-        } else if (command == UPDATENODE) {
-            string originalNodeName, newNodeName;
-            cout << "Enter original node name: " << endl;
-            getline(cin, originalNodeName);
-            cout << "Enter new node name: " << endl;
-            getline(cin, newNodeName);
+        }
+    } else if (command == UPDATENODE) {
+        string originalNodeName, newNodeName;
+        if (readArgument("Enter original node name: ", originalNodeName) &&
+            readArgument("Enter new node name: ", newNodeName)) {
             updateNodeName(originalNodeName, newNodeName);
-        } else if (command == UPDATEEDGE) {
-            if(kWeighted) {
-                string startNodeName, endNodeName;
-                int weight;
-                cout << "Enter start node name: " << endl;
-                getline(cin, startNodeName);
-                cout << "Enter end node name: " << endl;
-                getline(cin, endNodeName);
-                cout << "Enter new weight: " << endl;
-                cin >> weight;
+        }
+    } else if (command == UPDATEEDGE) {
+        if(kWeighted) {
+            string startNodeName, endNodeName;
+            int weight;
+            if (readArgument("Enter start node name: ", startNodeName) &&
+                readArgument("Enter end node name: ", endNodeName) &&
+                readWeight("Enter new weight: ", weight)) {
                 updateEdgeWeight(startNodeName, endNodeName, weight);
             }
-        } else if (command == EXIT) {
-            iterate = false;
-        } else if (command == "") {
-            continue;
-        } else {
-            //Default
-            cout << command << ": command not recognized." << endl;
         }
+    } else if (command == EXIT) {
+        return false;
+    } else if (line.find_first_not_of(" \t") == string_view::npos) {
+        return true;
+    } else {
+        //Default
+        *out << line << ": command not recognized." << '\n';
     }
-}
\ No newline at end of file
+    return true;
+}
@@ -16,10 +16,36 @@
 
 #include "Node.h"
 #include "Edge.h"
+#include "NameIndex.h"
+#include "CSRGraph.h"
+#include "VisitedSet.h"
+#include "IndexedHeap.h"
+#include "ObjectArena.h"
+#include "DisjointSet.h"
+#include "ShortestPath.h"
+#include "ParallelBFS.h"
+#include "StronglyConnectedComps.h"
+#include "ConnectedComps.h"
+#include "DynamicTopoOrder.h"
+#include "DynamicMST.h"
+#include "GraphSnapshot.h"
+#include "MappedFile.h"
+#include "EdgeListParser.h"
+#include "GraphPolicy.h"
+#include "GraphVisitors.h"
+#include "ParallelLoader.h"
+#include "Parallel.h"
+#include "Scheduler.h"
+#include "CaptureBuffer.h"
+#include "OutputBuffer.h"
+#include "Stats.h"
+#include <cstdint>
 #include <string>
+#include <string_view>
 #include <vector>
-#include <map>
-#include <list>
+#include <unordered_map>
+#include <memory>
+#include <ostream>
 
 extern bool kWeighted;
 extern bool kDirected;
@@ -33,29 +59,105 @@ extern bool kStronglyConnectedComps;
 extern bool kPrim;
 extern bool kKruskal;
 extern bool kShortestPath;
+extern bool kCSR;
+extern bool kAcyclic;
+
+/**
+ * Read-only view of the outgoing edges of one node, backed either by the
+ * mutable Node/Edge structures or by the frozen CSR arrays
+ */
+struct AdjacencyRow {
+	int nodeID;
+	int size;
+	const int* targets;
+	const int* weights;
+	const int* edgeIDs;
+	Edge* const* edges;
+
+	int target(int i) const { return targets ? targets[i] : edges[i]->getNext(nodeID); };
+	int weight(int i) const { return weights ? weights[i] : (edges ? edges[i]->getWeight() : 1); };
+
+	/** Accessors for kernels that know the graph features at compile time */
+	template <class Policy>
+	int target(int i) const {
+		if constexpr (Policy::weighted && !Policy::csr) {
+			return edges[i]->getNext(nodeID);
+		} else {
+			return targets[i];
+		}
+	};
+	template <class Policy>
+	int weight(int i) const {
+		if constexpr (!Policy::weighted) {
+			return 1;
+		} else if constexpr (Policy::csr) {
+			return weights[i];
+		} else {
+			return edges[i]->getWeight();
+		}
+	};
+};
+
+/**
+ * Start-up options of a GraphApp, set from the command line
+ */
+struct AppOptions {
+	std::string configFilename = "feature.config";
+	std::string graphFilename = "graphWeighted.in";
+	std::string format = "auto";		// auto, text or snapshot
+	bool verifySnapshot = false;		// checks every array of a snapshot when it is opened
+	std::string storage;				// csr or lists; empty keeps kCSR from the config
+	std::string outputFilename;			// empty writes to the standard output
+	int threadCount = 0;				// 0 uses every hardware thread
+	bool timing = false;				// reports load and command times on stderr
+	bool stats = false;					// reports the graph size on stderr after loading
+	std::string statsFilename;			// command statistics written on exit; empty writes none
+	bool cacheResults = true;			// replays read-only commands on an unchanged graph
+};
 
 class GraphApp {
     public:
 	/**	Constructors/Destructors */
 	GraphApp(std::string configFile, std::string graphFilename);
+	GraphApp(const AppOptions& options);
 	~GraphApp();
 
 	/** Driver Methods */
 	void handleCommands();
+	void runScript(std::string scriptFilename);
+	bool runCommand(std::string_view line);
+	void resetDerivedState();			// lets benchmarks time the cold path
     
 	/**Private Variables */
     std::vector<Node*> nodes;
-    std::map<int,std::vector<Edge*>> edges;
+    std::vector<std::vector<Edge*>> edges;	// weighted edges of every node
+	ObjectArena<Node> nodeArena;
+	ObjectArena<Edge> edgeArena;
     private:
 
 	std::vector<std::string> activeCommands;
 
     // /** Private Graph Algorithms*/
 	bool isCyclic();
-	bool DFS(int nodeID, int parent, std::string command);
-    void BFS(int nodeID, std::string command);
+	void updateTopoOrder();
+	void checkAcyclic();
+	bool orderEdge(int startNodeID, int endNodeID);
+	bool closeCycle();
+	bool admitEdge(const std::string& startNodeName, const std::string& endNodeName, int& startNodeID, int& endNodeID);
+	template <class Policy, class Visitor> bool DFS(int nodeID, Visitor& visitor);
+	template <class Policy, class Visitor> bool BFS(int nodeID, Visitor& visitor);
+	void breadthFirstSearch(std::string startNodeName);
 	void connectedComponents();
+	int computeComponents(std::vector<int>& labels);
+	void updateComponents();
+	void checkConnected(std::string startNodeName, std::string endNodeName);
+	void stronglyConnectedComponents();
+	void printComponents(const std::vector<int>& components, int componentCount);
 	void MSTPrim();
+	void repairMST(int startNodeID, int endNodeID, int newWeight);
+	void MSTKruskal();
+	void sortEdgesByWeight(ArrayView<int> weights, std::vector<int>& order);
+	void findShortestPath(std::string startNodeName, std::string endNodeName);
 
 	/** Edit Graph Methods*/
 	void addNode(std::string nodeName);
@@ -65,16 +167,86 @@ class GraphApp {
 	void updateEdgeWeight(std::string startNode, std::string endNode, int newWeight);
 
 	/** Helper Methods and Variables */
-    std::map<int, bool> visited;
-	std::map<int, bool> recurStack;
+    VisitedSet visited;
+	VisitedSet recurStack;
 	std::vector<int> ancestors;
+
+	/** Explicit DFS stack: node, parent and position of the next neighbor to explore */
+	struct DFSFrame {
+		int nodeID;
+		int parent;
+		int next;
+	};
+	std::vector<DFSFrame> dfsStack;
+	/** BFS queue of (node, parent) pairs */
+	std::vector<std::pair<int, int>> bfsQueue;
+	IndexedHeap<4> primHeap;
 	int parentNodeID;
 	void loadConfig (std::string filename);
-	void loadGraph (std::string filename);
+	void loadGraph (std::string filename, std::string format, bool verifySnapshot);
 	void setupMenu();
 	int printHeader();
 	void clearVisited();
 	bool checkNode(std::string nodeName);
+	AdjacencyRow row(int nodeID);
+	template <class Policy> AdjacencyRow row(int nodeID);
+	void freezeGraph();
+	void thawGraph();
+	void prepareStorage();
+	void indexNames();
+	int nodeCount();
+	std::string_view nodeName(int nodeID);
+	void loadSnapshot(std::string snapshotFilename, bool verify);
+	void saveSnapshot(std::string snapshotFilename);
+	const CSRGraph& reverseGraph();
+	TreeEdge rowEdge(const AdjacencyRow& adjacency, int i);
+	int internNode(std::string_view nodeName);
+	NameIndex nameIndex;
+	CSRGraph csr;
+	bool csrDirty;
+	CSRGraph reverseCsr;
+	bool reverseDirty;
+	ShortestPath shortestPath;
+	ParallelBFS levelSearch;
+	StronglyConnectedComps sccFinder;
+	ConnectedComps ccFinder;
+	DisjointSet componentSets;
+	bool componentsReady;
+	DynamicTopoOrder topoOrder;
+	bool topoReady;
+	bool topoCyclic;
+	DynamicMST mstCache;
+	bool mstReady;
+
+	/** Output of read-only commands, valid while graphVersion is cacheVersion */
+	uint64_t graphVersion;
+	uint64_t cacheVersion;
+	std::unordered_map<std::string, std::string> resultCache;
+	bool cacheResults;
+	static constexpr size_t MAX_CACHED_BYTES = 64 << 20;
+	GraphSnapshot snapshot;
+	bool builderReady;
+	int threadCount;
+	MappedFile graphText;
+	std::vector<std::string_view> frozenNames;
+
+	/** Command output, and the arguments given on the current command line */
+	std::ostream* out;
+	std::unique_ptr<OutputBuffer> fileBuffer;
+	std::unique_ptr<std::ostream> fileOut;
+	bool batchMode;
+	bool timing;
+	CommandStats commandStats;
+	std::string statsFilename;
+	bool executeCommand(const std::string& command, std::string_view line);
+	bool executeCached(const std::string& command, std::string_view line);
+	int cachedArgumentCount(const std::string& command);
+	int argumentCount(const std::string& command);
+	std::vector<std::string_view> commandArguments;
+	size_t nextArgument;
+	std::string matchCommand(std::string_view line, std::string_view& arguments);
+	bool readArgument(const std::string& prompt, std::string& value);
+	bool readWeight(const std::string& prompt, int& weight);
 
     /** Debugging methods */
     void printNeighbors();
@@ -84,15 +256,21 @@ class GraphApp {
     const std::string HELP = "help";
     const std::string CYCLE = "cycle checking";
     const std::string CC = "connected components";
+    const std::string CONNECTED = "connected";
+    const std::string COMPONENTCOUNT = "component count";
     const std::string SCC = "strongly connected components";
     const std::string PRIM = "prim";
     const std::string KRUSKAL = "kruskal";
     const std::string SHORTESTPATH = "shortest path";
+    const std::string BFSEARCH = "breadth first search";
 	const std::string ADDNODE = "add node";
 	const std::string ADDEDGE = "add edge";
 	const std::string UPDATENODE = "update node";
 	const std::string UPDATEEDGE = "update edge";
 	const std::string PRINTGRAPH = "print graph";
+	const std::string SAVESNAPSHOT = "save snapshot";
+	const std::string STATS = "stats";
+	const std::string SAVESTATS = "save stats";
 	
 	
     const std::string EXIT = "quit";
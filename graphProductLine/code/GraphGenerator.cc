@@ -0,0 +1,231 @@
+/**
+ * @file GraphGenerator.cc
+ *
+ * @author agent
+ * @date 2026-10-17
+ *
+ * @brief Defines the class GraphGenerator, which builds reproducible
+ * synthetic edge lists for benchmarking and writes them as graph files
+ */
+
+#include "GraphGenerator.h"
+#include <charconv>
+#include <cmath>
+#include <fstream>
+#include <utility>
+
+using namespace std;
+
+/**
+ * @brief Construct a new GraphGenerator:: GraphGenerator object. The same
+ * seed gives the same graphs on every platform.
+ *
+ * @param seed
+ */
+GraphGenerator::GraphGenerator(uint64_t seed) : state{seed}, nodeCount{0} {
+
+}
+
+/**
+ * @brief Returns the next number of a splitmix64 sequence
+ *
+ * @return uint64_t
+ */
+uint64_t GraphGenerator::next() {
+    uint64_t z = (state += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+/**
+ * @brief Returns a number in [0, bound)
+ *
+ * @param bound
+ * @return int
+ */
+int GraphGenerator::below(int bound) {
+    return (int)((next() >> 32) * (uint64_t)bound >> 32);
+}
+
+void GraphGenerator::reset(int nodeCount) {
+    this->nodeCount = nodeCount;
+    starts.clear();
+    ends.clear();
+    weights.clear();
+}
+
+void GraphGenerator::addEdge(int start, int end) {
+    starts.push_back(start);
+    ends.push_back(end);
+    weights.push_back(1 + below(100));
+}
+
+/**
+ * @brief Uniform random graph with a fixed number of edges, G(n, m)
+ *
+ * @param nodeCount
+ * @param edgeCount
+ */
+void GraphGenerator::erdosRenyi(int nodeCount, long long edgeCount) {
+    reset(nodeCount);
+    for (long long e = 0; e < edgeCount; e++) {
+        addEdge(below(nodeCount), below(nodeCount));
+    }
+}
+
+/**
+ * @brief Recursive matrix (Kronecker) graph with the Graph500 parameters
+ * a = 0.57, b = c = 0.19. The node count is rounded up to a power of two
+ * and node IDs are shuffled so hubs are spread over the ID range.
+ *
+ * @param nodeCount
+ * @param edgeCount
+ */
+void GraphGenerator::rmat(int nodeCount, long long edgeCount) {
+    int scale = 0;
+    while ((1 << scale) < nodeCount) {
+        scale++;
+    }
+    reset(1 << scale);
+
+    vector<int> permutation(this->nodeCount);
+    for (int u = 0; u < this->nodeCount; u++) {
+        permutation[u] = u;
+    }
+    for (int u = this->nodeCount - 1; u > 0; u--) {
+        swap(permutation[u], permutation[below(u + 1)]);
+    }
+
+    const uint64_t A = 57, B = 19, C = 19;
+    for (long long e = 0; e < edgeCount; e++) {
+        int start = 0, end = 0;
+        for (int bit = 0; bit < scale; bit++) {
+            uint64_t quadrant = next() % 100;
+            start <<= 1;
+            end <<= 1;
+            if (quadrant < A) {
+                continue;
+            } else if (quadrant < A + B) {
+                end |= 1;
+            } else if (quadrant < A + B + C) {
+                start |= 1;
+            } else {
+                start |= 1;
+                end |= 1;
+            }
+        }
+        addEdge(permutation[start], permutation[end]);
+    }
+}
+
+/**
+ * @brief Square lattice with edges to the right and down neighbors, a
+ * stand-in for road networks: low degree and a large diameter
+ *
+ * @param nodeCount: rounded down to a square
+ */
+void GraphGenerator::grid(int nodeCount) {
+    int side = max(1, (int)sqrt((double)nodeCount));
+    reset(side * side);
+    for (int row = 0; row < side; row++) {
+        for (int col = 0; col < side; col++) {
+            int u = row * side + col;
+            if (col + 1 < side) {
+                addEdge(u, u + 1);
+            }
+            if (row + 1 < side) {
+                addEdge(u, u + side);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Single path through every node, the worst case for recursion
+ * depth and for level-synchronous searches
+ *
+ * @param nodeCount
+ */
+void GraphGenerator::chain(int nodeCount) {
+    reset(nodeCount);
+    for (int u = 0; u + 1 < nodeCount; u++) {
+        addEdge(u, u + 1);
+    }
+}
+
+/**
+ * @brief Runs a generator by name: er, rmat, grid or chain. Random graphs
+ * get an average degree of 8.
+ *
+ * @param kind
+ * @param nodeCount
+ * @return true
+ * @return false if the generator is unknown
+ */
+bool GraphGenerator::generate(const string& kind, int nodeCount) {
+    if (kind == "er") {
+        erdosRenyi(nodeCount, 4LL * nodeCount);
+    } else if (kind == "rmat") {
+        rmat(nodeCount, 4LL * nodeCount);
+    } else if (kind == "grid") {
+        grid(nodeCount);
+    } else if (kind == "chain") {
+        chain(nodeCount);
+    } else {
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Returns the name of a node that is in the edge list
+ *
+ * @return string
+ */
+string GraphGenerator::firstNodeName() const {
+    return "n" + to_string(starts.empty() ? 0 : starts[0]);
+}
+
+/**
+ * @brief Writes one "start end [weight]" line per edge, with nodes named
+ * n0, n1, ...
+ *
+ * @param filename
+ * @param weighted
+ * @return true
+ * @return false if the file could not be written
+ */
+bool GraphGenerator::write(const string& filename, bool weighted) const {
+    ofstream file(filename, ios::binary);
+    if (!file) {
+        return false;
+    }
+
+    string buffer;
+    buffer.reserve(1 << 20);
+    char number[16];
+    auto append = [&](int value) {
+        auto result = to_chars(number, number + sizeof(number), value);
+        buffer.append(number, result.ptr);
+    };
+
+    for (size_t e = 0; e < starts.size(); e++) {
+        buffer += 'n';
+        append(starts[e]);
+        buffer += " n";
+        append(ends[e]);
+        if (weighted) {
+            buffer += ' ';
+            append(weights[e]);
+        }
+        buffer += '\n';
+
+        if (buffer.size() >= (1 << 20) - 64) {
+            file.write(buffer.data(), buffer.size());
+            buffer.clear();
+        }
+    }
+    file.write(buffer.data(), buffer.size());
+    return (bool)file;
+}
@@ -0,0 +1,49 @@
+/**
+ * @file GraphGenerator.h
+ *
+ * @author agent
+ * @date 2026-10-17
+ *
+ * @brief Defines the class GraphGenerator, which builds reproducible
+ * synthetic edge lists for benchmarking and writes them as graph files
+ */
+
+#ifndef GRAPH_APP_GRAPHGENERATOR_H
+#define GRAPH_APP_GRAPHGENERATOR_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class GraphGenerator {
+	public:
+	/**	Constructors/Destructors */
+	GraphGenerator(uint64_t seed);
+
+	/** Generators: each one replaces the current edge list */
+	void erdosRenyi(int nodeCount, long long edgeCount);
+	void rmat(int nodeCount, long long edgeCount);
+	void grid(int nodeCount);
+	void chain(int nodeCount);
+	bool generate(const std::string& kind, int nodeCount);
+
+	/** Accessor methods */
+	int getNodeCount() const { return nodeCount; };
+	long long getEdgeCount() const { return (long long)starts.size(); };
+	std::string firstNodeName() const;
+
+	/** Writes the edge list in the text format read by GraphApp */
+	bool write(const std::string& filename, bool weighted) const;
+
+	private:
+	uint64_t state;
+	int nodeCount;
+	std::vector<int> starts, ends, weights;
+
+	uint64_t next();
+	int below(int bound);
+	void addEdge(int start, int end);
+	void reset(int nodeCount);
+};
+
+#endif //GRAPH_APP_GRAPHGENERATOR_H
@@ -0,0 +1,67 @@
+/**
+ * @file GraphPolicy.h
+ *
+ * @author agent
+ * @date 2026-10-17
+ *
+ * @brief Defines the class template GraphPolicy, which turns the graph
+ * features of a product into compile-time constants, and the dispatcher
+ * that picks the instantiation matching the feature configuration
+ */
+
+#ifndef GRAPH_APP_GRAPHPOLICY_H
+#define GRAPH_APP_GRAPHPOLICY_H
+
+/**
+ * Graph features and storage known at compile time. Kernels templated on
+ * a policy test them with if constexpr, so each product gets its own
+ * branch-free loops.
+ */
+template <bool IsWeighted, bool IsDirected, bool IsCSR>
+struct GraphPolicy {
+	static constexpr bool weighted = IsWeighted;
+	static constexpr bool directed = IsDirected;
+	static constexpr bool undirected = !IsDirected;
+	static constexpr bool csr = IsCSR;		// frozen CSR arrays, or the mutable Node/Edge structures
+};
+
+/**
+ * @brief Calls kernel with the policy of the given features and the
+ * runtime storage
+ *
+ * @param csr
+ * @param kernel
+ */
+template <bool IsWeighted, bool IsDirected, class Kernel>
+decltype(auto) dispatchStorage(bool csr, Kernel&& kernel) {
+	if (csr) {
+		return kernel(GraphPolicy<IsWeighted, IsDirected, true>());
+	}
+	return kernel(GraphPolicy<IsWeighted, IsDirected, false>());
+}
+
+/**
+ * @brief Calls kernel with the policy matching the runtime features, and
+ * returns its result. The kernel is typically a generic lambda taking
+ * the policy as an "auto" tag parameter.
+ *
+ * @param weighted
+ * @param directed
+ * @param csr
+ * @param kernel
+ */
+template <class Kernel>
+decltype(auto) dispatchPolicy(bool weighted, bool directed, bool csr, Kernel&& kernel) {
+	if (weighted) {
+		if (directed) {
+			return dispatchStorage<true, true>(csr, kernel);
+		}
+		return dispatchStorage<true, false>(csr, kernel);
+	}
+	if (directed) {
+		return dispatchStorage<false, true>(csr, kernel);
+	}
+	return dispatchStorage<false, false>(csr, kernel);
+}
+
+#endif //GRAPH_APP_GRAPHPOLICY_H
@@ -0,0 +1,287 @@
+/**
+ * @file GraphSnapshot.cc
+ *
+ * @author agent
+ * @date 2026-10-17
+ *
+ * @brief Defines the class GraphSnapshot, a versioned binary file holding
+ * the CSR arrays and node names of a graph, opened with mmap so the
+ * graph can be used without parsing or copying
+ */
+
+#include "GraphSnapshot.h"
+#include <climits>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+using namespace std;
+
+static const char MAGIC[8] = {'G', 'R', 'A', 'P', 'H', 'S', 'N', 'P'};
+
+/**
+ * @brief Rounds a section size up to the 8-byte alignment of the file
+ *
+ * @param bytes
+ * @return uint64_t
+ */
+static uint64_t padded(uint64_t bytes) {
+    return (bytes + 7) & ~(uint64_t)7;
+}
+
+/**
+ * @brief Construct a new GraphSnapshot:: GraphSnapshot object
+ *
+ */
+GraphSnapshot::GraphSnapshot() : nameOffsets{nullptr}, names{nullptr} {
+
+}
+
+/**
+ * @brief Destroy the GraphSnapshot:: GraphSnapshot object
+ *
+ */
+GraphSnapshot::~GraphSnapshot() {
+    close();
+}
+
+/**
+ * @brief Checks whether the file starts with the snapshot magic bytes
+ *
+ * @param filename
+ * @return true
+ * @return false
+ */
+bool GraphSnapshot::isSnapshot(const string& filename) {
+    ifstream file(filename, ios::binary);
+    char magic[8];
+    if (!file.read(magic, sizeof(magic))) {
+        return false;
+    }
+    return memcmp(magic, MAGIC, sizeof(MAGIC)) == 0;
+}
+
+/**
+ * @brief Writes the graph and its node names to a snapshot file. The file
+ * is written under a temporary name and renamed over the target, so a
+ * graph mapped from the target keeps valid pages while it is read.
+ *
+ * @param filename
+ * @param graph
+ * @param nodeName: returns the name of a node ID
+ * @return true
+ * @return false
+ */
+bool GraphSnapshot::write(const string& filename, const CSRGraph& graph,
+    const function<string_view(int)>& nodeName) {
+    string temporaryFilename = filename + ".tmp";
+    ofstream file(temporaryFilename, ios::binary | ios::trunc);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    int nodeCount = graph.getNodeCount();
+    vector<uint64_t> offsets(nodeCount + 1, 0);
+    for (int u = 0; u < nodeCount; u++) {
+        offsets[u + 1] = offsets[u] + nodeName(u).size();
+    }
+
+    Header header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = VERSION;
+    header.flags = (graph.isWeighted() ? WEIGHTED : 0) |
+        (graph.isDirected() ? DIRECTED : 0) |
+        (graph.hasNegativeWeights() ? NEGATIVE_WEIGHTS : 0) |
+        (graph.edgeIDs.empty() ? 0 : EDGE_IDS);
+    header.nodeCount = nodeCount;
+    header.edgeCount = graph.getEdgeCount();
+    header.slotCount = graph.targets.size();
+    header.nameBytes = offsets[nodeCount];
+    file.write((const char*)&header, sizeof(header));
+
+    const char zeros[8] = {0};
+    auto section = [&](const void* data, uint64_t bytes) {
+        file.write((const char*)data, bytes);
+        file.write(zeros, padded(bytes) - bytes);
+    };
+
+    section(graph.offsets.data(), graph.offsets.size() * sizeof(int));
+    section(graph.targets.data(), graph.targets.size() * sizeof(int));
+    section(graph.weights.data(), graph.weights.size() * sizeof(int));
+    section(graph.edgeIDs.data(), graph.edgeIDs.size() * sizeof(int));
+    section(graph.edgeStarts.data(), graph.edgeStarts.size() * sizeof(int));
+    section(graph.edgeEnds.data(), graph.edgeEnds.size() * sizeof(int));
+    section(graph.edgeWeights.data(), graph.edgeWeights.size() * sizeof(int));
+    section(offsets.data(), offsets.size() * sizeof(uint64_t));
+    for (int u = 0; u < nodeCount; u++) {
+        string_view name = nodeName(u);
+        file.write(name.data(), name.size());
+    }
+    file.write(zeros, padded(header.nameBytes) - header.nameBytes);
+
+    file.close();
+    if (!file || rename(temporaryFilename.c_str(), filename.c_str()) != 0) {
+        remove(temporaryFilename.c_str());
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Checks that offsets start at 0, never decrease and end at last
+ *
+ * @param offsets
+ * @param count: number of offsets
+ * @param last
+ * @return true
+ * @return false
+ */
+template <typename T>
+static bool isMonotonic(const T* offsets, uint64_t count, uint64_t last) {
+    if (offsets[0] != 0) {
+        return false;
+    }
+    for (uint64_t i = 1; i < count; i++) {
+        if (offsets[i] < offsets[i - 1]) {
+            return false;
+        }
+    }
+    return (uint64_t)offsets[count - 1] == last;
+}
+
+/**
+ * @brief Checks that every value lies in [0, limit)
+ *
+ * @param values
+ * @param count
+ * @param limit
+ * @return true
+ * @return false
+ */
+static bool inRange(const int* values, uint64_t count, uint64_t limit) {
+    for (uint64_t i = 0; i < count; i++) {
+        if (values[i] < 0 || (uint64_t)values[i] >= limit) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Maps a snapshot file read-only and points the graph at its
+ * arrays. Processes opening the same file share its page cache. Only the
+ * header, the section sizes and the ends of the offset arrays are
+ * checked, so opening does not read the arrays. verify also checks every
+ * offset and node ID, which reads the whole file.
+ *
+ * @param filename
+ * @param graph
+ * @param verify: check the arrays so a corrupt file can't be read out of bounds
+ * @return true
+ * @return false if the file can't be mapped or isn't a valid snapshot
+ */
+bool GraphSnapshot::open(const string& filename, CSRGraph& graph, bool verify) {
+    close();
+
+    if (!file.open(filename) || file.size() < sizeof(Header)) {
+        close();
+        return false;
+    }
+
+    const char* base = file.data();
+    const Header* header = (const Header*)base;
+    if (memcmp(header->magic, MAGIC, sizeof(MAGIC)) != 0 || header->version != VERSION) {
+        close();
+        return false;
+    }
+
+    bool weighted = header->flags & WEIGHTED;
+    bool hasEdgeIDs = header->flags & EDGE_IDS;
+    uint64_t nodes = header->nodeCount;
+    uint64_t edges = header->edgeCount;
+    uint64_t slots = header->slotCount;
+    if (nodes >= (uint64_t)INT_MAX || edges >= (uint64_t)INT_MAX || slots >= (uint64_t)INT_MAX ||
+        header->nameBytes > file.size()) {
+        close();
+        return false;
+    }
+
+    // Locate every section and check that the file holds all of them. The
+    // sizes are bounded above, so padding them can't overflow.
+    uint64_t position = sizeof(Header);
+    bool fits = true;
+    auto section = [&](uint64_t bytes) {
+        uint64_t start = position;
+        if (padded(bytes) > file.size() - position) {
+            fits = false;
+            return start;
+        }
+        position += padded(bytes);
+        return start;
+    };
+    uint64_t offsetsAt = section((nodes + 1) * sizeof(int));
+    uint64_t targetsAt = section(slots * sizeof(int));
+    uint64_t weightsAt = section((weighted ? slots : 0) * sizeof(int));
+    uint64_t edgeIDsAt = section((hasEdgeIDs ? slots : 0) * sizeof(int));
+    uint64_t startsAt = section(edges * sizeof(int));
+    uint64_t endsAt = section(edges * sizeof(int));
+    uint64_t edgeWeightsAt = section((weighted ? edges : 0) * sizeof(int));
+    uint64_t nameOffsetsAt = section((nodes + 1) * sizeof(uint64_t));
+    uint64_t namesAt = section(header->nameBytes);
+
+    if (!fits) {
+        close();
+        return false;
+    }
+
+    const int* offsets = (const int*)(base + offsetsAt);
+    nameOffsets = (const uint64_t*)(base + nameOffsetsAt);
+    names = base + namesAt;
+    const int* targets = (const int*)(base + targetsAt);
+    const int* edgeIDs = (const int*)(base + edgeIDsAt);
+    const int* starts = (const int*)(base + startsAt);
+    const int* ends = (const int*)(base + endsAt);
+    if (offsets[0] != 0 || (uint64_t)offsets[nodes] != slots ||
+        nameOffsets[0] != 0 || nameOffsets[nodes] != header->nameBytes) {
+        close();
+        return false;
+    }
+    if (verify && (!isMonotonic(offsets, nodes + 1, slots) || !isMonotonic(nameOffsets, nodes + 1, header->nameBytes) ||
+        !inRange(targets, slots, nodes) || !inRange(edgeIDs, hasEdgeIDs ? slots : 0, edges) ||
+        !inRange(starts, edges, nodes) || !inRange(ends, edges, nodes))) {
+        close();
+        return false;
+    }
+
+    graph.attach((int)nodes, weighted, header->flags & DIRECTED, header->flags & NEGATIVE_WEIGHTS,
+        ArrayView<int>(offsets, nodes + 1),
+        ArrayView<int>(targets, slots),
+        ArrayView<int>((const int*)(base + weightsAt), weighted ? slots : 0),
+        ArrayView<int>(edgeIDs, hasEdgeIDs ? slots : 0),
+        ArrayView<int>(starts, edges),
+        ArrayView<int>(ends, edges),
+        ArrayView<int>((const int*)(base + edgeWeightsAt), weighted ? edges : 0));
+    return true;
+}
+
+/**
+ * @brief Unmaps the file. Graphs attached to it must not be used afterwards.
+ *
+ */
+void GraphSnapshot::close() {
+    file.close();
+    nameOffsets = nullptr;
+    names = nullptr;
+}
+
+/**
+ * @brief Name of a node, pointing into the mapped file
+ *
+ * @param nodeID
+ * @return std::string_view
+ */
+string_view GraphSnapshot::name(int nodeID) const {
+    return string_view(names + nameOffsets[nodeID], nameOffsets[nodeID + 1] - nameOffsets[nodeID]);
+}
@@ -0,0 +1,72 @@
+/**
+ * @file GraphSnapshot.h
+ *
+ * @author agent
+ * @date 2026-10-17
+ *
+ * @brief Defines the class GraphSnapshot, a versioned binary file holding
+ * the CSR arrays and node names of a graph, opened with mmap so the
+ * graph can be used without parsing or copying
+ */
+
+#ifndef GRAPH_APP_GRAPHSNAPSHOT_H
+#define GRAPH_APP_GRAPHSNAPSHOT_H
+
+#include "CSRGraph.h"
+#include "MappedFile.h"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+
+class GraphSnapshot {
+	public:
+	/**	Constructors/Destructors */
+	GraphSnapshot();
+	GraphSnapshot(const GraphSnapshot&) = delete;
+	GraphSnapshot& operator=(const GraphSnapshot&) = delete;
+	~GraphSnapshot();
+
+	/** File methods */
+	static bool isSnapshot(const std::string& filename);
+	static bool write(const std::string& filename, const CSRGraph& graph,
+		const std::function<std::string_view(int)>& nodeName);
+	bool open(const std::string& filename, CSRGraph& graph, bool verify = false);
+	void close();
+
+	/** Accessor methods */
+	bool isOpen() const { return file.isOpen(); };
+	std::string_view name(int nodeID) const;
+
+	static const uint32_t VERSION = 1;
+
+	private:
+	/**
+	 * File layout: this header, then the sections offsets, targets, weights,
+	 * edgeIDs, edgeStarts, edgeEnds, edgeWeights (int32), nameOffsets
+	 * (uint64) and the name characters, each padded to 8 bytes. Integers
+	 * use the byte order of the machine that wrote the file.
+	 */
+	struct Header {
+		char magic[8];
+		uint32_t version;
+		uint32_t flags;
+		uint64_t nodeCount;
+		uint64_t edgeCount;
+		uint64_t slotCount;
+		uint64_t nameBytes;
+		uint64_t reserved[3];
+	};
+
+	static const uint32_t WEIGHTED = 1;
+	static const uint32_t DIRECTED = 2;
+	static const uint32_t NEGATIVE_WEIGHTS = 4;
+	static const uint32_t EDGE_IDS = 8;
+
+	MappedFile file;
+	const uint64_t* nameOffsets;
+	const char* names;
+};
+
+#endif //GRAPH_APP_GRAPHSNAPSHOT_H
@@ -0,0 +1,81 @@
+/**
+ * @file GraphVisitors.h
+ *
+ * @author agent
+ * @date 2026-10-17
+ *
+ * @brief Defines the visitors run by the DFS and BFS traversals of
+ * GraphApp: the no-op base, cycle detection and component labeling
+ */
+
+#ifndef GRAPH_APP_GRAPHVISITORS_H
+#define GRAPH_APP_GRAPHVISITORS_H
+
+#include "VisitedSet.h"
+#include <vector>
+
+/**
+ * Base of the traversal visitors. The traversals are templates on the
+ * visitor type and call its hooks directly, so they are inlined; a
+ * visitor only redefines the hooks it needs.
+ */
+struct TraversalVisitor {
+	/** Called when a node is reached for the first time; parent is -1 for the root */
+	void discover(int /*nodeID*/, int /*parent*/) {};
+
+	/** Called for every edge out of a node, before the traversal follows
+	 *  it. seen tells whether next was already discovered. Returning true
+	 *  stops the traversal. */
+	bool examineEdge(int /*nodeID*/, int /*parent*/, int /*next*/, bool /*seen*/) { return false; };
+
+	/** Called once every edge out of the node has been examined */
+	void finish(int /*nodeID*/) {};
+};
+
+/**
+ * Stops a DFS at the first cycle: a back edge to a node on the DFS path
+ * in directed graphs, an edge to an already discovered node other than
+ * the parent in undirected graphs
+ */
+template <class Policy>
+struct CycleVisitor : TraversalVisitor {
+	VisitedSet& recurStack;
+
+	CycleVisitor(VisitedSet& recurStack) : recurStack{recurStack} {};
+
+	void discover(int nodeID, int /*parent*/) {
+		if constexpr (Policy::directed) {
+			recurStack.set(nodeID);
+		}
+	};
+
+	bool examineEdge(int /*nodeID*/, int parent, int next, bool seen) {
+		if constexpr (Policy::directed) {
+			return seen && recurStack.test(next);
+		} else {
+			return seen && next != parent;
+		}
+	};
+
+	void finish(int nodeID) {
+		if constexpr (Policy::directed) {
+			recurStack.reset(nodeID);
+		}
+	};
+};
+
+/**
+ * Labels every discovered node with the current component number
+ */
+struct ComponentVisitor : TraversalVisitor {
+	std::vector<int>& labels;
+	int component;
+
+	ComponentVisitor(std::vector<int>& labels) : labels{labels}, component{0} {};
+
+	void discover(int nodeID, int /*parent*/) {
+		labels[nodeID] = component;
+	};
+};
+
+#endif //GRAPH_APP_GRAPHVISITORS_H
@@ -0,0 +1,140 @@
+/**
+ * @file IndexedHeap.h
+ *
+ * @author agent
+ * @date 2026-10-17
+ *
+ * @brief Defines the class template IndexedHeap, a d-ary min-heap of node
+ * IDs keyed by integer priorities that supports decrease-key
+ */
+
+#ifndef GRAPH_APP_INDEXEDHEAP_H
+#define GRAPH_APP_INDEXEDHEAP_H
+
+#include "Stats.h"
+#include <vector>
+
+template <int Arity = 4>
+class IndexedHeap {
+	public:
+	/** Accessor methods */
+	bool empty() const { return heap.empty(); };
+	int size() const { return (int)heap.size(); };
+	bool contains(int id) const { return id < (int)position.size() && position[id] != ABSENT; };
+	int top() const { return heap[0]; };
+	int topKey() const { return keys[heap[0]]; };
+	int key(int id) const { return keys[id]; };
+
+	/**
+	 * @brief Makes room for IDs up to capacity - 1
+	 *
+	 * @param capacity
+	 */
+	void resize(int capacity) {
+		if (capacity > (int)position.size()) {
+			position.resize(capacity, ABSENT);
+			keys.resize(capacity);
+		}
+	}
+
+	/**
+	 * @brief Removes the remaining IDs. Costs O(size), not O(capacity).
+	 *
+	 */
+	void clear() {
+		for (int id : heap) {
+			position[id] = ABSENT;
+		}
+		heap.clear();
+	}
+
+	/**
+	 * @brief Inserts the ID, or lowers its key if it is already in the heap.
+	 * Returns false if the ID is already in the heap with a key <= newKey.
+	 *
+	 * @param id
+	 * @param newKey
+	 * @return true
+	 * @return false
+	 */
+	bool pushOrDecrease(int id, int newKey) {
+		if (position[id] == ABSENT) {
+			keys[id] = newKey;
+			position[id] = (int)heap.size();
+			heap.push_back(id);
+		} else if (newKey < keys[id]) {
+			keys[id] = newKey;
+		} else {
+			return false;
+		}
+		STAT_ADD(heapPushes, 1);
+		siftUp(position[id]);
+		return true;
+	}
+
+	/**
+	 * @brief Removes and returns the ID with the smallest key
+	 *
+	 * @return int
+	 */
+	int pop() {
+		int id = heap[0];
+		position[id] = ABSENT;
+		STAT_ADD(heapPops, 1);
+
+		int last = heap.back();
+		heap.pop_back();
+		if (!heap.empty()) {
+			heap[0] = last;
+			position[last] = 0;
+			siftDown(0);
+		}
+		return id;
+	}
+
+	private:
+	std::vector<int> heap;
+	std::vector<int> keys;
+	std::vector<int> position;
+
+	static constexpr int ABSENT = -1;
+
+	void place(int i, int id) {
+		heap[i] = id;
+		position[id] = i;
+	}
+
+	void siftUp(int i) {
+		int id = heap[i];
+		while (i > 0) {
+			int parent = (i - 1) / Arity;
+			if (keys[heap[parent]] <= keys[id]) break;
+			place(i, heap[parent]);
+			i = parent;
+		}
+		place(i, id);
+	}
+
+	void siftDown(int i) {
+		int id = heap[i];
+		int n = (int)heap.size();
+		while (true) {
+			int first = i * Arity + 1;
+			if (first >= n) break;
+
+			int last = first + Arity < n ? first + Arity : n;
+			int best = first;
+			for (int child = first + 1; child < last; child++) {
+				if (keys[heap[child]] < keys[heap[best]]) {
+					best = child;
+				}
+			}
+			if (keys[heap[best]] >= keys[id]) break;
+			place(i, heap[best]);
+			i = best;
+		}
+		place(i, id);
+	}
+};
+
+#endif //GRAPH_APP_INDEXEDHEAP_H
@@ -0,0 +1,87 @@
+/**
+ * @file MappedFile.cc
+ *
+ * @author agent
+ * @date 2026-10-17
+ *
+ * @brief Defines the class MappedFile, a read-only memory mapping of a
+ * whole file
+ */
+
+#include "MappedFile.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace std;
+
+/**
+ * @brief Construct a new MappedFile:: MappedFile object
+ *
+ */
+MappedFile::MappedFile() : base{nullptr}, length{0}, opened{false} {
+
+}
+
+/**
+ * @brief Destroy the MappedFile:: MappedFile object
+ *
+ */
+MappedFile::~MappedFile() {
+    close();
+}
+
+/**
+ * @brief Maps the file read-only and shared, so processes mapping the
+ * same file share its page cache. Empty files open as an empty range.
+ *
+ * @param filename
+ * @param sequential: hint the kernel to read ahead aggressively
+ * @return true
+ * @return false
+ */
+bool MappedFile::open(const string& filename, bool sequential) {
+    close();
+
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd == -1) {
+        return false;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        ::close(fd);
+        return false;
+    }
+
+    if (info.st_size > 0) {
+        void* mapped = mmap(nullptr, info.st_size, PROT_READ, MAP_SHARED, fd, 0);
+        if (mapped == MAP_FAILED) {
+            ::close(fd);
+            return false;
+        }
+        if (sequential) {
+            madvise(mapped, info.st_size, MADV_SEQUENTIAL);
+        }
+        base = (const char*)mapped;
+        length = info.st_size;
+    }
+
+    ::close(fd);
+    opened = true;
+    return true;
+}
+
+/**
+ * @brief Unmaps the file
+ *
+ */
+void MappedFile::close() {
+    if (base != nullptr) {
+        munmap((void*)base, length);
+    }
+    base = nullptr;
+    length = 0;
+    opened = false;
+}
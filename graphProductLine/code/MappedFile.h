@@ -0,0 +1,41 @@
+/**
+ * @file MappedFile.h
+ *
+ * @author agent
+ * @date 2026-10-17
+ *
+ * @brief Defines the class MappedFile, a read-only memory mapping of a
+ * whole file
+ */
+
+#ifndef GRAPH_APP_MAPPEDFILE_H
+#define GRAPH_APP_MAPPEDFILE_H
+
+#include <cstddef>
+#include <string>
+
+class MappedFile {
+	public:
+	/**	Constructors/Destructors */
+	MappedFile();
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+	~MappedFile();
+
+	/** File methods */
+	bool open(const std::string& filename, bool sequential = false);
+	void close();
+
+	/** Accessor methods */
+	bool isOpen() const { return opened; };
+	const char* data() const { return base; };
+	size_t size() const { return length; };
+	const char* end() const { return base + length; };
+
+	private:
+	const char* base;
+	size_t length;
+	bool opened;
+};
+
+#endif //GRAPH_APP_MAPPEDFILE_H
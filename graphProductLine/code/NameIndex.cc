@@ -0,0 +1,215 @@
+/**
+ * @file NameIndex.cc
+ *
+ * @author agent
+ * @date 2026-10-17
+ *
+ * @brief Defines the class NameIndex, an interned string table that maps
+ * node names to node IDs using open addressing
+ */
+
+#include "NameIndex.h"
+
+using namespace std;
+
+/**
+ * @brief Construct a new NameIndex:: NameIndex object
+ *
+ */
+NameIndex::NameIndex() : deadBytes{0}, count{0}, mask{0} {
+    slots.assign(16, Slot{0, 0, 0, EMPTY});
+    mask = slots.size() - 1;
+}
+
+/**
+ * @brief Destroy the NameIndex:: NameIndex object
+ *
+ */
+NameIndex::~NameIndex() {
+
+}
+
+/**
+ * @brief FNV-1a hash of a node name
+ *
+ * @param name
+ * @return uint64_t
+ */
+uint64_t NameIndex::hash(string_view name) {
+    uint64_t h = 14695981039346656037ULL;
+    for (unsigned char c : name) {
+        h ^= c;
+        h *= 1099511628211ULL;
+    }
+    return h;
+}
+
+string_view NameIndex::nameAt(const Slot& slot) const {
+    return string_view(pool.data() + slot.offset, slot.length);
+}
+
+/**
+ * @brief Linear probing from the home slot of the name. Returns the slot
+ * holding the name, or the empty slot where it would be inserted.
+ *
+ * @param name
+ * @param h: hash of the name
+ * @return size_t
+ */
+size_t NameIndex::findSlot(string_view name, uint64_t h) const {
+    size_t i = h & mask;
+    while (slots[i].id != EMPTY) {
+        if (slots[i].hash == h && nameAt(slots[i]) == name) {
+            return i;
+        }
+        i = (i + 1) & mask;
+    }
+    return i;
+}
+
+/**
+ * @brief Returns the ID of the node with the provided name, or -1
+ *
+ * @param name
+ * @return int
+ */
+int NameIndex::find(string_view name) const {
+    return slots[findSlot(name, hash(name))].id;
+}
+
+/**
+ * @brief Interns a new name. Returns false if the name is already indexed
+ * or longer than 4 GiB.
+ *
+ * @param name
+ * @param id
+ * @return true
+ * @return false
+ */
+bool NameIndex::insert(string_view name, int id) {
+    // Keep the load factor under 1/2 so probe sequences stay short
+    if ((count + 1) * 2 > slots.size()) {
+        grow();
+    }
+
+    uint64_t h = hash(name);
+    size_t i = findSlot(name, h);
+    if (slots[i].id != EMPTY || name.size() > UINT32_MAX) {
+        return false;
+    }
+
+    slots[i] = Slot{h, (uint64_t)pool.size(), (uint32_t)name.size(), id};
+    pool.append(name.data(), name.size());
+    count++;
+    return true;
+}
+
+/**
+ * @brief Moves the ID indexed under oldName to newName. Returns false if
+ * oldName is unknown or newName is already taken. The old name stays in
+ * the pool until renamed names fill half of it, then the pool is compacted.
+ *
+ * @param oldName
+ * @param newName
+ * @return true
+ * @return false
+ */
+bool NameIndex::rename(string_view oldName, string_view newName) {
+    size_t i = findSlot(oldName, hash(oldName));
+    if (slots[i].id == EMPTY || contains(newName)) {
+        return false;
+    }
+
+    int id = slots[i].id;
+    deadBytes += slots[i].length;
+    erase(i);
+    if (deadBytes * 2 > pool.size()) {
+        compact();
+    }
+    return insert(newName, id);
+}
+
+/**
+ * @brief Copies the names still indexed into a new pool, dropping the
+ * bytes of renamed names
+ *
+ */
+void NameIndex::compact() {
+    string live;
+    live.reserve(pool.size() - deadBytes);
+    for (Slot& slot : slots) {
+        if (slot.id != EMPTY) {
+            uint64_t offset = live.size();
+            live.append(pool, slot.offset, slot.length);
+            slot.offset = offset;
+        }
+    }
+    pool.swap(live);
+    deadBytes = 0;
+}
+
+/**
+ * @brief Removes a slot using backward-shift deletion, so no tombstones
+ * are left behind in the probe sequences
+ *
+ * @param slotIndex
+ */
+void NameIndex::erase(size_t slotIndex) {
+    size_t hole = slotIndex;
+    size_t i = (hole + 1) & mask;
+    while (slots[i].id != EMPTY) {
+        size_t home = slots[i].hash & mask;
+        // Shift back entries whose home slot is not in (hole, i]
+        if (((i - home) & mask) >= ((i - hole) & mask)) {
+            slots[hole] = slots[i];
+            hole = i;
+        }
+        i = (i + 1) & mask;
+    }
+    slots[hole].id = EMPTY;
+    count--;
+}
+
+/**
+ * @brief Doubles the table and re-inserts all entries
+ *
+ */
+void NameIndex::grow() {
+    vector<Slot> old;
+    old.swap(slots);
+    slots.assign(old.size() * 2, Slot{0, 0, 0, EMPTY});
+    mask = slots.size() - 1;
+
+    for (const Slot& slot : old) {
+        if (slot.id != EMPTY) {
+            size_t i = slot.hash & mask;
+            while (slots[i].id != EMPTY) {
+                i = (i + 1) & mask;
+            }
+            slots[i] = slot;
+        }
+    }
+}
+
+/**
+ * @brief Sizes the table for the expected number of names
+ *
+ * @param expectedNames
+ */
+void NameIndex::reserve(size_t expectedNames) {
+    while (expectedNames * 2 > slots.size()) {
+        grow();
+    }
+}
+
+/**
+ * @brief Removes all names from the index
+ *
+ */
+void NameIndex::clear() {
+    slots.assign(16, Slot{0, 0, 0, EMPTY});
+    mask = slots.size() - 1;
+    pool.clear();
+    deadBytes = 0;
+    count = 0;
+}
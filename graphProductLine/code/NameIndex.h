@@ -0,0 +1,61 @@
+/**
+ * @file NameIndex.h
+ *
+ * @author agent
+ * @date 2026-10-17
+ *
+ * @brief Defines the class NameIndex, an interned string table that maps
+ * node names to node IDs using open addressing
+ */
+
+#ifndef GRAPH_APP_NAMEINDEX_H
+#define GRAPH_APP_NAMEINDEX_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+class NameIndex {
+	public:
+	/**	Constructors/Destructors */
+	NameIndex();
+	~NameIndex();
+
+	/** Lookup methods */
+	int find(std::string_view name) const;
+	bool contains(std::string_view name) const { return find(name) != -1; };
+	size_t size() const { return count; };
+
+	/** Editing methods */
+	bool insert(std::string_view name, int id);
+	bool rename(std::string_view oldName, std::string_view newName);
+	void reserve(size_t expectedNames);
+	void clear();
+
+	static uint64_t hash(std::string_view name);
+
+	private:
+	struct Slot {
+		uint64_t hash;
+		uint64_t offset;
+		uint32_t length;
+		int id;
+	};
+
+	std::vector<Slot> slots;
+	std::string pool;
+	size_t deadBytes;	// pool bytes of names that were renamed away
+	size_t count;
+	size_t mask;
+
+	std::string_view nameAt(const Slot& slot) const;
+	size_t findSlot(std::string_view name, uint64_t h) const;
+	void erase(size_t slotIndex);
+	void grow();
+	void compact();
+
+	static const int EMPTY = -1;
+};
+
+#endif //GRAPH_APP_NAMEINDEX_H
@@ -0,0 +1,115 @@
+/**
+ * @file ObjectArena.h
+ *
+ * @author agent
+ * @date 2026-10-17
+ *
+ * @brief Defines the class template ObjectArena, which allocates objects
+ * of one type contiguously in slabs and frees them all at once
+ */
+
+#ifndef GRAPH_APP_OBJECTARENA_H
+#define GRAPH_APP_OBJECTARENA_H
+
+#include "Stats.h"
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+template <class T>
+class ObjectArena {
+	public:
+	/**	Constructors/Destructors */
+	ObjectArena() : used{0}, count{0}, nextSlabSize{MIN_SLAB} {};
+	ObjectArena(const ObjectArena&) = delete;
+	ObjectArena& operator=(const ObjectArena&) = delete;
+	~ObjectArena() { clear(); };
+
+	/** Accessor methods */
+	size_t size() const { return count; };
+
+	/**
+	 * @brief Constructs an object in the current slab, starting a new
+	 * slab when it is full. Objects never move.
+	 *
+	 * @param args: constructor arguments
+	 * @return T*
+	 */
+	template <class... Args>
+	T* create(Args&&... args) {
+		if (slabs.empty() || used == slabs.back().capacity) {
+			addSlab(nextSlabSize);
+			nextSlabSize = std::min(nextSlabSize * 2, MAX_SLAB);
+		}
+		Slab& slab = slabs.back();
+		T* object = new (slab.storage.get() + used) T(std::forward<Args>(args)...);
+		used++;
+		count++;
+		return object;
+	}
+
+	/**
+	 * @brief Makes room for expected more objects in one slab, so a bulk
+	 * load allocates once
+	 *
+	 * @param expected
+	 */
+	void reserve(size_t expected) {
+		size_t room = slabs.empty() ? 0 : slabs.back().capacity - used;
+		if (expected > room) {
+			addSlab(expected);
+		}
+	}
+
+	/**
+	 * @brief Destroys every object and frees the slabs
+	 *
+	 */
+	void clear() {
+		for (size_t s = 0; s < slabs.size(); s++) {
+			size_t objects = s + 1 == slabs.size() ? used : slabs[s].used;
+			T* first = reinterpret_cast<T*>(slabs[s].storage.get());
+			for (size_t i = 0; i < objects; i++) {
+				first[i].~T();
+			}
+		}
+		slabs.clear();
+		used = 0;
+		count = 0;
+		nextSlabSize = MIN_SLAB;
+	}
+
+	private:
+	typedef typename std::aligned_storage<sizeof(T), alignof(T)>::type Storage;
+
+	/** Raw storage for capacity objects, of which used are constructed */
+	struct Slab {
+		std::unique_ptr<Storage[]> storage;
+		size_t capacity;
+		size_t used;
+	};
+
+	std::vector<Slab> slabs;
+	size_t used;
+	size_t count;
+	size_t nextSlabSize;
+
+	static constexpr size_t MIN_SLAB = 256;
+	static constexpr size_t MAX_SLAB = 65536;
+
+	void addSlab(size_t capacity) {
+		if (!slabs.empty()) {
+			slabs.back().used = used;
+		}
+		slabs.push_back(Slab{std::unique_ptr<Storage[]>(new Storage[capacity]), capacity, 0});
+		STAT_ADD(allocations, 1);
+		STAT_ADD(allocatedBytes, capacity * sizeof(Storage));
+		used = 0;
+	}
+};
+
+#endif //GRAPH_APP_OBJECTARENA_H
@@ -0,0 +1,86 @@
+/**
+ * @file OutputBuffer.cc
+ *
+ * @author agent
+ * @date 2026-10-17
+ *
+ * @brief Defines the class OutputBuffer, a stream buffer that collects
+ * output in one large block and writes it to a file descriptor when full
+ */
+
+#include "OutputBuffer.h"
+#include <cerrno>
+#include <unistd.h>
+
+using namespace std;
+
+/**
+ * @brief Construct a new OutputBuffer:: OutputBuffer object
+ *
+ * @param fd: file descriptor the output is written to
+ * @param capacity: bytes collected before a write
+ * @param ownsFile: whether to close the file descriptor on destruction
+ */
+OutputBuffer::OutputBuffer(int fd, size_t capacity, bool ownsFile) : fd{fd}, ownsFile{ownsFile}, buffer(capacity) {
+    setp(buffer.data(), buffer.data() + buffer.size());
+}
+
+/**
+ * @brief Destroy the OutputBuffer:: OutputBuffer object, writing what is
+ * left in the buffer
+ *
+ */
+OutputBuffer::~OutputBuffer() {
+    writeBuffer();
+    if (ownsFile) {
+        ::close(fd);
+    }
+}
+
+/**
+ * @brief Writes the buffered bytes, retrying short and interrupted writes
+ *
+ * @return true
+ * @return false if the write failed
+ */
+bool OutputBuffer::writeBuffer() {
+    const char* p = pbase();
+    while (p < pptr()) {
+        ssize_t written = ::write(fd, p, pptr() - p);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        p += written;
+    }
+    setp(buffer.data(), buffer.data() + buffer.size());
+    return true;
+}
+
+/**
+ * @brief Called when the buffer is full: writes it and stores c
+ *
+ * @param c
+ * @return int
+ */
+int OutputBuffer::overflow(int c) {
+    if (!writeBuffer()) {
+        return traits_type::eof();
+    }
+    if (c != traits_type::eof()) {
+        *pptr() = (char)c;
+        pbump(1);
+    }
+    return traits_type::not_eof(c);
+}
+
+/**
+ * @brief Called on flush: writes the buffer
+ *
+ * @return int
+ */
+int OutputBuffer::sync() {
+    return writeBuffer() ? 0 : -1;
+}
@@ -0,0 +1,39 @@
+/**
+ * @file OutputBuffer.h
+ *
+ * @author agent
+ * @date 2026-10-17
+ *
+ * @brief Defines the class OutputBuffer, a stream buffer that collects
+ * output in one large block and writes it to a file descriptor when full
+ */
+
+#ifndef GRAPH_APP_OUTPUTBUFFER_H
+#define GRAPH_APP_OUTPUTBUFFER_H
+
+#include <cstddef>
+#include <streambuf>
+#include <vector>
+
+class OutputBuffer : public std::streambuf {
+	public:
+	/**	Constructors/Destructors */
+	OutputBuffer(int fd, size_t capacity = 1 << 20, bool ownsFile = false);
+	OutputBuffer(const OutputBuffer&) = delete;
+	OutputBuffer& operator=(const OutputBuffer&) = delete;
+	~OutputBuffer();
+
+	protected:
+	/** std::streambuf overrides */
+	int overflow(int c) override;
+	int sync() override;
+
+	private:
+	int fd;
+	bool ownsFile;
+	std::vector<char> buffer;
+
+	bool writeBuffer();
+};
+
+#endif //GRAPH_APP_OUTPUTBUFFER_H
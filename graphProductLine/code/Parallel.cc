@@ -0,0 +1,46 @@
+/**
+ * @file Parallel.cc
+ *
+ * @author agent
+ * @date 2026-10-17
+ *
+ * @brief Defines the parallel loop and sort helpers shared by the
+ * loaders and graph algorithms
+ */
+
+#include "Parallel.h"
+#include "Scheduler.h"
+#include <thread>
+
+using namespace std;
+
+/**
+ * @brief Number of hardware threads, at least 1
+ *
+ * @return int
+ */
+int defaultThreadCount() {
+    unsigned count = thread::hardware_concurrency();
+    return count == 0 ? 1 : (int)count;
+}
+
+/**
+ * @brief Runs body(0) .. body(taskCount - 1) as tasks of the shared
+ * work-stealing scheduler and returns when all are done. threadCount is
+ * the parallelism the caller planned its tasks for; with 1 the loop runs
+ * inline on the calling thread.
+ *
+ * @param taskCount
+ * @param threadCount
+ * @param body
+ */
+void parallelFor(int taskCount, int threadCount, const function<void(int)>& body) {
+    if (threadCount <= 1 || taskCount <= 1) {
+        for (int task = 0; task < taskCount; task++) {
+            body(task);
+        }
+        return;
+    }
+
+    Scheduler::global().parallelFor(taskCount, body);
+}
@@ -0,0 +1,56 @@
+/**
+ * @file Parallel.h
+ *
+ * @author agent
+ * @date 2026-10-17
+ *
+ * @brief Declares the parallel loop and sort helpers shared by the
+ * loaders and graph algorithms
+ */
+
+#ifndef GRAPH_APP_PARALLEL_H
+#define GRAPH_APP_PARALLEL_H
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+int defaultThreadCount();
+
+void parallelFor(int taskCount, int threadCount, const std::function<void(int)>& body);
+
+/**
+ * @brief Sorts a vector by sorting one slice per thread and merging the
+ * slices pairwise
+ *
+ * @param items
+ * @param less
+ * @param threadCount
+ */
+template <class T, class Less>
+void parallelSort(std::vector<T>& items, Less less, int threadCount) {
+	int slices = std::max(1, std::min(threadCount, (int)(items.size() / 4096) + 1));
+	std::vector<size_t> bounds(slices + 1);
+	for (int s = 0; s <= slices; s++) {
+		bounds[s] = items.size() * s / slices;
+	}
+
+	parallelFor(slices, threadCount, [&](int s) {
+		std::sort(items.begin() + bounds[s], items.begin() + bounds[s + 1], less);
+	});
+
+	for (int width = 1; width < slices; width *= 2) {
+		int merges = (slices + 2 * width - 1) / (2 * width);
+		parallelFor(merges, threadCount, [&](int m) {
+			int first = m * 2 * width;
+			int middle = std::min(first + width, slices);
+			int last = std::min(first + 2 * width, slices);
+			if (middle < last) {
+				std::inplace_merge(items.begin() + bounds[first], items.begin() + bounds[middle],
+					items.begin() + bounds[last], less);
+			}
+		});
+	}
+}
+
+#endif //GRAPH_APP_PARALLEL_H
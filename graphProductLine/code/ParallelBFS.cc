@@ -0,0 +1,220 @@
+/**
+ * @file ParallelBFS.cc
+ *
+ * @author agent
+ * @date 2026-10-17
+ *
+ * @brief Defines the class ParallelBFS, a level-synchronous parallel
+ * breadth-first search that switches between top-down and bottom-up
+ * sweeps (direction-optimizing BFS)
+ */
+
+#include "ParallelBFS.h"
+#include "Parallel.h"
+#include <algorithm>
+
+using namespace std;
+
+/** Nodes per parallel task; a multiple of 64 so tasks own whole bitmap words */
+static const int BLOCK_SIZE = 4096;
+
+/**
+ * @brief Construct a new ParallelBFS:: ParallelBFS object
+ *
+ */
+ParallelBFS::ParallelBFS() : reachedCount{0} {
+
+}
+
+/**
+ * @brief Destroy the ParallelBFS:: ParallelBFS object
+ *
+ */
+ParallelBFS::~ParallelBFS() {
+
+}
+
+/**
+ * @brief Computes the BFS distance and parent of every node reachable from
+ * the source. Each level is expanded top-down from the frontier queue
+ * while the frontier is small, and bottom-up (unvisited nodes look for a
+ * parent in the frontier bitmap) while it touches a large share of the
+ * remaining edges. Distances are deterministic; when a node has several
+ * parents on the previous level, any of them may be recorded.
+ *
+ * @param graph
+ * @param incoming: the transpose of graph, or graph itself if undirected
+ * @param source
+ * @param threadCount
+ * @return int: number of levels, i.e. the largest distance plus one
+ */
+int ParallelBFS::run(const CSRGraph& graph, const CSRGraph& incoming, int source, int threadCount) {
+    int nodeCount = graph.getNodeCount();
+    size_t words = ((size_t)nodeCount + 63) / 64;
+    dist.assign(nodeCount, UNREACHED);
+    parent.assign(nodeCount, UNREACHED);
+    visitedBits = vector<atomic<uint64_t>>(words);
+    frontierBits.assign(words, 0);
+    nextBits.assign(words, 0);
+
+    dist[source] = 0;
+    parent[source] = source;
+    visitedBits[source / 64] = 1ULL << (source % 64);
+    frontier.assign(1, source);
+    reachedCount = 1;
+
+    long long edgesToCheck = graph.degree(source);
+    long long unexploredEdges = (long long)graph.targets.size() - edgesToCheck;
+    int level = 0;
+
+    while (!frontier.empty()) {
+        if (edgesToCheck > unexploredEdges / ALPHA) {
+            // Bottom-up while the frontier stays large or keeps growing
+            queueToBitmap();
+            int awake = (int)frontier.size();
+            int previous;
+            do {
+                previous = awake;
+                awake = bottomUpStep(incoming, level++, threadCount);
+                reachedCount += awake;
+                frontierBits.swap(nextBits);
+            } while (awake > 0 && (awake >= previous || awake > nodeCount / BETA));
+            bitmapToQueue(threadCount);
+            edgesToCheck = 0;
+            for (int u : frontier) {
+                edgesToCheck += graph.degree(u);
+            }
+        } else {
+            unexploredEdges -= edgesToCheck;
+            edgesToCheck = topDownStep(graph, level++, threadCount);
+            reachedCount += (int)frontier.size();
+        }
+    }
+    return level;
+}
+
+/**
+ * @brief Expands every frontier node into its unvisited neighbors and
+ * replaces the frontier with them. Returns the number of edges leaving the
+ * new frontier.
+ *
+ * @param graph
+ * @param level: distance of the current frontier
+ * @param threadCount
+ * @return long long
+ */
+long long ParallelBFS::topDownStep(const CSRGraph& graph, int level, int threadCount) {
+    int blocks = ((int)frontier.size() + BLOCK_SIZE - 1) / BLOCK_SIZE;
+    vector<vector<int>> found(blocks);
+    vector<long long> scouts(blocks, 0);
+
+    parallelFor(blocks, threadCount, [&](int b) {
+        int first = b * BLOCK_SIZE;
+        int last = min((int)frontier.size(), first + BLOCK_SIZE);
+        for (int i = first; i < last; i++) {
+            int u = frontier[i];
+            for (int slot = graph.offsets[u]; slot < graph.offsets[u + 1]; slot++) {
+                int v = graph.targets[slot];
+                uint64_t bit = 1ULL << (v % 64);
+                if ((visitedBits[v / 64].load(memory_order_relaxed) & bit) == 0 &&
+                    (visitedBits[v / 64].fetch_or(bit, memory_order_relaxed) & bit) == 0) {
+                    dist[v] = level + 1;
+                    parent[v] = u;
+                    found[b].push_back(v);
+                    scouts[b] += graph.degree(v);
+                }
+            }
+        }
+    });
+
+    frontier.clear();
+    long long edgesToCheck = 0;
+    for (int b = 0; b < blocks; b++) {
+        frontier.insert(frontier.end(), found[b].begin(), found[b].end());
+        edgesToCheck += scouts[b];
+    }
+    return edgesToCheck;
+}
+
+/**
+ * @brief Lets every unvisited node look for a parent in the frontier
+ * bitmap, stopping at the first one found. Each task owns a range of
+ * bitmap words, so no atomic updates are needed. Returns the number of
+ * nodes added to the next frontier.
+ *
+ * @param incoming
+ * @param level: distance of the current frontier
+ * @param threadCount
+ * @return int
+ */
+int ParallelBFS::bottomUpStep(const CSRGraph& incoming, int level, int threadCount) {
+    int nodeCount = incoming.getNodeCount();
+    int blocks = (nodeCount + BLOCK_SIZE - 1) / BLOCK_SIZE;
+    vector<int> awake(blocks, 0);
+
+    parallelFor(blocks, threadCount, [&](int b) {
+        int first = b * BLOCK_SIZE;
+        int last = min(nodeCount, first + BLOCK_SIZE);
+        fill(nextBits.begin() + first / 64, nextBits.begin() + (last + 63) / 64, 0);
+        for (int v = first; v < last; v++) {
+            uint64_t bit = 1ULL << (v % 64);
+            if (visitedBits[v / 64].load(memory_order_relaxed) & bit) {
+                continue;
+            }
+            for (int slot = incoming.offsets[v]; slot < incoming.offsets[v + 1]; slot++) {
+                int u = incoming.targets[slot];
+                if (frontierBits[u / 64] & (1ULL << (u % 64))) {
+                    dist[v] = level + 1;
+                    parent[v] = u;
+                    visitedBits[v / 64].fetch_or(bit, memory_order_relaxed);
+                    nextBits[v / 64] |= bit;
+                    awake[b]++;
+                    break;
+                }
+            }
+        }
+    });
+
+    int total = 0;
+    for (int count : awake) {
+        total += count;
+    }
+    return total;
+}
+
+/**
+ * @brief Converts the frontier queue into the frontier bitmap
+ *
+ */
+void ParallelBFS::queueToBitmap() {
+    fill(frontierBits.begin(), frontierBits.end(), 0);
+    for (int u : frontier) {
+        frontierBits[u / 64] |= 1ULL << (u % 64);
+    }
+}
+
+/**
+ * @brief Converts the frontier bitmap into the frontier queue, in node
+ * order
+ *
+ * @param threadCount
+ */
+void ParallelBFS::bitmapToQueue(int threadCount) {
+    int blocks = ((int)frontierBits.size() * 64 + BLOCK_SIZE - 1) / BLOCK_SIZE;
+    vector<vector<int>> found(blocks);
+
+    parallelFor(blocks, threadCount, [&](int b) {
+        size_t first = (size_t)b * BLOCK_SIZE / 64;
+        size_t last = min(frontierBits.size(), first + BLOCK_SIZE / 64);
+        for (size_t w = first; w < last; w++) {
+            for (uint64_t bits = frontierBits[w]; bits != 0; bits &= bits - 1) {
+                found[b].push_back((int)(w * 64 + __builtin_ctzll(bits)));
+            }
+        }
+    });
+
+    frontier.clear();
+    for (auto& block : found) {
+        frontier.insert(frontier.end(), block.begin(), block.end());
+    }
+}
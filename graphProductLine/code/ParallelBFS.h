@@ -0,0 +1,56 @@
+/**
+ * @file ParallelBFS.h
+ *
+ * @author agent
+ * @date 2026-10-17
+ *
+ * @brief Defines the class ParallelBFS, a level-synchronous parallel
+ * breadth-first search that switches between top-down and bottom-up
+ * sweeps (direction-optimizing BFS)
+ */
+
+#ifndef GRAPH_APP_PARALLELBFS_H
+#define GRAPH_APP_PARALLELBFS_H
+
+#include "CSRGraph.h"
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+class ParallelBFS {
+	public:
+	/**	Constructors/Destructors */
+	ParallelBFS();
+	~ParallelBFS();
+
+	/** Search methods */
+	int run(const CSRGraph& graph, const CSRGraph& incoming, int source, int threadCount);
+
+	/** Accessor methods for the results of the last search */
+	const std::vector<int>& getDistances() const { return dist; };
+	const std::vector<int>& getParents() const { return parent; };
+	int getReachedCount() const { return reachedCount; };
+
+	static constexpr int UNREACHED = -1;
+
+	/** Direction switching thresholds from Beamer et al. */
+	static constexpr int ALPHA = 15;
+	static constexpr int BETA = 18;
+
+	private:
+	std::vector<int> dist;
+	std::vector<int> parent;
+	int reachedCount;
+
+	/** One bit per node; visited bits are claimed with fetch_or */
+	std::vector<std::atomic<uint64_t>> visitedBits;
+	std::vector<uint64_t> frontierBits, nextBits;
+	std::vector<int> frontier;
+
+	long long topDownStep(const CSRGraph& graph, int level, int threadCount);
+	int bottomUpStep(const CSRGraph& incoming, int level, int threadCount);
+	void queueToBitmap();
+	void bitmapToQueue(int threadCount);
+};
+
+#endif //GRAPH_APP_PARALLELBFS_H
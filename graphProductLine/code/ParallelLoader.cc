@@ -0,0 +1,147 @@
+/**
+ * @file ParallelLoader.cc
+ *
+ * @author agent
+ * @date 2026-10-17
+ *
+ * @brief Defines the class ParallelLoader, which parses a memory-mapped
+ * edge list on several threads and builds the CSR arrays directly
+ */
+
+#include "ParallelLoader.h"
+#include "EdgeListParser.h"
+#include "ShardedNameTable.h"
+#include "Parallel.h"
+#include <algorithm>
+
+using namespace std;
+
+/**
+ * @brief Construct a new ParallelLoader:: ParallelLoader object
+ *
+ * @param threadCount
+ */
+ParallelLoader::ParallelLoader(int threadCount) : threadCount{max(1, threadCount)} {
+
+}
+
+/**
+ * @brief Destroy the ParallelLoader:: ParallelLoader object
+ *
+ */
+ParallelLoader::~ParallelLoader() {
+
+}
+
+/**
+ * @brief Cuts the file into a few chunks per thread. Every chunk but the
+ * first starts right after a newline, so no line is split.
+ *
+ * @param file
+ */
+void ParallelLoader::split(const MappedFile& file) {
+    int count = threadCount * 4;
+    const char* cursor = file.data();
+    chunks.clear();
+    chunks.resize(count);
+
+    for (int c = 0; c < count; c++) {
+        const char* end = file.data() + file.size() * (c + 1) / count;
+        if (end < cursor) {
+            end = cursor;
+        } else if (end > file.data() && end < file.end() && end[-1] != '\n') {
+            const char* newline = EdgeListParser::findNewline(end, file.end());
+            end = newline < file.end() ? newline + 1 : file.end();
+        }
+        chunks[c].begin = cursor;
+        chunks[c].end = end;
+        cursor = end;
+    }
+}
+
+/**
+ * @brief Loads the edge list in four parallel phases: chunks are parsed
+ * and their names interned, names are numbered by first appearance, edge
+ * endpoints are translated to node IDs, and the CSR arrays are built.
+ * Node IDs, edge order and error messages are the same as with a
+ * sequential load.
+ *
+ * @param file: must stay mapped while the names are in use
+ * @param filename: used in error messages
+ * @param weighted
+ * @param directed
+ * @param graph
+ * @param names: node names by ID, pointing into the file
+ * @param errors
+ */
+void ParallelLoader::load(const MappedFile& file, const string& filename, bool weighted, bool directed,
+    CSRGraph& graph, vector<string_view>& names, ostream& errors) {
+    split(file);
+    ShardedNameTable table;
+    int expectedElems = weighted ? 3 : 2;
+
+    // Endpoints are stored as name table handles until IDs are assigned
+    parallelFor((int)chunks.size(), threadCount, [&](int c) {
+        Chunk& chunk = chunks[c];
+        EdgeListParser parser(chunk.begin, chunk.end);
+        string_view lineElems[3];
+        int elemCount;
+
+        while (parser.nextLine(lineElems, 3, elemCount)) {
+            if (elemCount == 0) {
+                continue;
+            }
+            if (elemCount < expectedElems) {
+                chunk.errors.emplace_back(parser.getLineNumber(), weighted ?
+                    "expected start node, end node and weight" : "expected start node and end node");
+                continue;
+            }
+
+            int weight = 0;
+            if (weighted && !EdgeListParser::parseInt(lineElems[2], weight)) {
+                chunk.errors.emplace_back(parser.getLineNumber(),
+                    "invalid weight '" + string(lineElems[2]) + "'");
+                continue;
+            }
+
+            chunk.starts.push_back(table.intern(lineElems[0], lineElems[0].data() - file.data()));
+            chunk.ends.push_back(table.intern(lineElems[1], lineElems[1].data() - file.data()));
+            if (weighted) {
+                chunk.weights.push_back(weight);
+            }
+        }
+        chunk.lineCount = count(chunk.begin, chunk.end, '\n');
+    });
+
+    int nodeCount = table.assignIDs(threadCount);
+    table.namesByID(names);
+
+    size_t lineOffset = 0;
+    size_t edgeCount = 0;
+    vector<size_t> firstEdge(chunks.size());
+    for (size_t c = 0; c < chunks.size(); c++) {
+        for (auto& error : chunks[c].errors) {
+            errors << filename << ":" << lineOffset + error.first << ": " << error.second << "\n";
+        }
+        lineOffset += chunks[c].lineCount;
+        firstEdge[c] = edgeCount;
+        edgeCount += chunks[c].starts.size();
+    }
+
+    vector<int> starts(edgeCount), ends(edgeCount), edgeWeights(weighted ? edgeCount : 0);
+    parallelFor((int)chunks.size(), threadCount, [&](int c) {
+        Chunk& chunk = chunks[c];
+        for (size_t i = 0; i < chunk.starts.size(); i++) {
+            starts[firstEdge[c] + i] = table.idOf(chunk.starts[i]);
+            ends[firstEdge[c] + i] = table.idOf(chunk.ends[i]);
+        }
+        copy(chunk.weights.begin(), chunk.weights.end(), edgeWeights.begin() + firstEdge[c]);
+        vector<int>().swap(chunk.starts);
+        vector<int>().swap(chunk.ends);
+        vector<int>().swap(chunk.weights);
+    });
+    chunks.clear();
+
+    graph.buildParallel(nodeCount, move(starts), move(ends), move(edgeWeights),
+        weighted, directed, threadCount);
+}
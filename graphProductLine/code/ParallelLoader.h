@@ -0,0 +1,51 @@
+/**
+ * @file ParallelLoader.h
+ *
+ * @author agent
+ * @date 2026-10-17
+ *
+ * @brief Defines the class ParallelLoader, which parses a memory-mapped
+ * edge list on several threads and builds the CSR arrays directly
+ */
+
+#ifndef GRAPH_APP_PARALLELLOADER_H
+#define GRAPH_APP_PARALLELLOADER_H
+
+#include "CSRGraph.h"
+#include "MappedFile.h"
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+class ParallelLoader {
+	public:
+	/**	Constructors/Destructors */
+	ParallelLoader(int threadCount);
+	~ParallelLoader();
+
+	/** Loading methods */
+	void load(const MappedFile& file, const std::string& filename, bool weighted, bool directed,
+		CSRGraph& graph, std::vector<std::string_view>& names, std::ostream& errors);
+
+	/** Files smaller than this are faster to load on one thread */
+	static constexpr size_t MIN_PARALLEL_BYTES = 4 << 20;
+
+	private:
+	/** Edges and malformed lines found in one newline-aligned chunk of the file */
+	struct Chunk {
+		const char* begin;
+		const char* end;
+		size_t lineCount;
+		std::vector<int> starts, ends, weights;
+		std::vector<std::pair<size_t, std::string>> errors;
+	};
+
+	int threadCount;
+	std::vector<Chunk> chunks;
+
+	void split(const MappedFile& file);
+};
+
+#endif //GRAPH_APP_PARALLELLOADER_H
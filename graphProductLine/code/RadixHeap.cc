@@ -0,0 +1,107 @@
+/**
+ * @file RadixHeap.cc
+ *
+ * @author agent
+ * @date 2026-10-17
+ *
+ * @brief Defines the class RadixHeap, a monotone priority queue of node IDs
+ * keyed by non-negative integer distances
+ */
+
+#include "RadixHeap.h"
+#include "Stats.h"
+
+using namespace std;
+
+/**
+ * @brief Construct a new RadixHeap:: RadixHeap object
+ *
+ */
+RadixHeap::RadixHeap() : last{0}, count{0} {
+
+}
+
+/**
+ * @brief Destroy the RadixHeap:: RadixHeap object
+ *
+ */
+RadixHeap::~RadixHeap() {
+
+}
+
+/**
+ * @brief Empties the heap, keeping the bucket memory for the next query
+ *
+ */
+void RadixHeap::clear() {
+    for (auto& bucket : buckets) {
+        bucket.clear();
+    }
+    last = 0;
+    count = 0;
+}
+
+/**
+ * @brief Inserts an ID. Keys must not be smaller than the last popped key.
+ *
+ * @param key
+ * @param id
+ */
+void RadixHeap::push(uint64_t key, int id) {
+    buckets[bucketOf(key, last)].emplace_back(key, id);
+    count++;
+    STAT_ADD(heapPushes, 1);
+}
+
+/**
+ * @brief Moves the smallest key of the first non-empty bucket into last
+ * and redistributes that bucket, which fills bucket 0
+ *
+ */
+void RadixHeap::refill() {
+    if (!buckets[0].empty()) {
+        return;
+    }
+
+    int i = 1;
+    while (buckets[i].empty()) {
+        i++;
+    }
+
+    uint64_t minKey = buckets[i][0].first;
+    for (auto& entry : buckets[i]) {
+        if (entry.first < minKey) {
+            minKey = entry.first;
+        }
+    }
+
+    last = minKey;
+    for (auto& entry : buckets[i]) {
+        buckets[bucketOf(entry.first, last)].push_back(entry);
+    }
+    buckets[i].clear();
+}
+
+/**
+ * @brief Returns the smallest key without removing it
+ *
+ * @return uint64_t
+ */
+uint64_t RadixHeap::topKey() {
+    refill();
+    return last;
+}
+
+/**
+ * @brief Removes and returns an entry with the smallest key
+ *
+ * @return std::pair<uint64_t, int>
+ */
+pair<uint64_t, int> RadixHeap::pop() {
+    refill();
+    pair<uint64_t, int> entry = buckets[0].back();
+    buckets[0].pop_back();
+    count--;
+    STAT_ADD(heapPops, 1);
+    return entry;
+}
@@ -0,0 +1,47 @@
+/**
+ * @file RadixHeap.h
+ *
+ * @author agent
+ * @date 2026-10-17
+ *
+ * @brief Defines the class RadixHeap, a monotone priority queue of node IDs
+ * keyed by non-negative integer distances
+ */
+
+#ifndef GRAPH_APP_RADIXHEAP_H
+#define GRAPH_APP_RADIXHEAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+class RadixHeap {
+	public:
+	/**	Constructors/Destructors */
+	RadixHeap();
+	~RadixHeap();
+
+	/** Accessor methods */
+	bool empty() const { return count == 0; };
+	size_t size() const { return count; };
+	uint64_t topKey();
+
+	/** Mutator methods */
+	void push(uint64_t key, int id);
+	std::pair<uint64_t, int> pop();
+	void clear();
+
+	private:
+	// Bucket i > 0 holds keys whose highest bit differing from last is bit i - 1
+	std::vector<std::pair<uint64_t, int>> buckets[65];
+	uint64_t last;
+	size_t count;
+
+	static int bucketOf(uint64_t key, uint64_t last) {
+		return key == last ? 0 : 64 - __builtin_clzll(key ^ last);
+	};
+	void refill();
+};
+
+#endif //GRAPH_APP_RADIXHEAP_H
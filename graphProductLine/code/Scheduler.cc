@@ -0,0 +1,325 @@
+/**
+ * @file Scheduler.cc
+ *
+ * @author agent
+ * @date 2026-10-17
+ *
+ * @brief Defines the class Scheduler, a work-stealing thread pool shared
+ * by every parallel loop in the program
+ */
+
+#include "Scheduler.h"
+#include "Parallel.h"
+
+using namespace std;
+
+/** Scheduler and deque index of the calling thread, if it is a worker */
+static thread_local Scheduler* currentScheduler = nullptr;
+static thread_local int currentWorker = -1;
+
+/**
+ * @brief Construct a new Scheduler:: TaskDeque:: TaskDeque object
+ *
+ */
+Scheduler::TaskDeque::TaskDeque() : top{0}, bottom{0} {
+    arrays.emplace_back(new Array(64));
+    array = arrays.back().get();
+}
+
+/**
+ * @brief Pushes a task at the bottom. Only called by the owner.
+ *
+ * @param task
+ */
+void Scheduler::TaskDeque::push(Task* task) {
+    long long b = bottom.load(memory_order_relaxed);
+    long long t = top.load(memory_order_acquire);
+    Array* a = array.load(memory_order_relaxed);
+
+    if (b - t > a->mask) {
+        Array* grown = new Array((a->mask + 1) * 2);
+        for (long long i = t; i < b; i++) {
+            grown->slots[i & grown->mask].store(a->slots[i & a->mask].load(memory_order_relaxed),
+                memory_order_relaxed);
+        }
+        arrays.emplace_back(grown);
+        array.store(grown, memory_order_release);
+        a = grown;
+    }
+
+    a->slots[b & a->mask].store(task, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    bottom.store(b + 1, memory_order_relaxed);
+}
+
+/**
+ * @brief Pops the most recently pushed task. Only called by the owner.
+ *
+ * @return Scheduler::Task*: nullptr if the deque is empty
+ */
+Scheduler::Task* Scheduler::TaskDeque::pop() {
+    long long b = bottom.load(memory_order_relaxed) - 1;
+    Array* a = array.load(memory_order_relaxed);
+    bottom.store(b, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    long long t = top.load(memory_order_relaxed);
+
+    Task* task = nullptr;
+    if (t <= b) {
+        task = a->slots[b & a->mask].load(memory_order_relaxed);
+        if (t == b) {
+            // Last task: race the thieves for it
+            if (!top.compare_exchange_strong(t, t + 1, memory_order_seq_cst, memory_order_relaxed)) {
+                task = nullptr;
+            }
+            bottom.store(b + 1, memory_order_relaxed);
+        }
+    } else {
+        bottom.store(b + 1, memory_order_relaxed);
+    }
+    return task;
+}
+
+/**
+ * @brief Steals the oldest task. Called by any thread.
+ *
+ * @return Scheduler::Task*: nullptr if the deque is empty or the steal
+ * lost a race
+ */
+Scheduler::Task* Scheduler::TaskDeque::steal() {
+    long long t = top.load(memory_order_acquire);
+    atomic_thread_fence(memory_order_seq_cst);
+    long long b = bottom.load(memory_order_acquire);
+
+    if (t < b) {
+        Array* a = array.load(memory_order_acquire);
+        Task* task = a->slots[t & a->mask].load(memory_order_relaxed);
+        if (top.compare_exchange_strong(t, t + 1, memory_order_seq_cst, memory_order_relaxed)) {
+            return task;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Construct a new Scheduler:: Scheduler object
+ *
+ * @param workerCount: threads besides the ones that submit work
+ */
+Scheduler::Scheduler(int workerCount) : injectedCount{0}, epoch{0}, sleepers{0}, stopping{false} {
+    startWorkers(workerCount);
+}
+
+/**
+ * @brief Destroy the Scheduler:: Scheduler object
+ *
+ */
+Scheduler::~Scheduler() {
+    stopWorkers();
+}
+
+/**
+ * @brief The scheduler used by parallelFor. A thread that waits for a
+ * loop also runs its tasks, so one thread per core fewer is started.
+ *
+ * @return Scheduler&
+ */
+Scheduler& Scheduler::global() {
+    static Scheduler scheduler(defaultThreadCount() - 1);
+    return scheduler;
+}
+
+/**
+ * @brief Replaces the workers with a new set of workerCount threads
+ *
+ * @param workerCount
+ */
+void Scheduler::setWorkerCount(int workerCount) {
+    if (workerCount != getWorkerCount()) {
+        stopWorkers();
+        startWorkers(workerCount);
+    }
+}
+
+void Scheduler::startWorkers(int workerCount) {
+    stopping = false;
+    deques.clear();
+    for (int w = 0; w < workerCount; w++) {
+        deques.emplace_back(new TaskDeque());
+    }
+    for (int w = 0; w < workerCount; w++) {
+        workers.emplace_back(&Scheduler::workerLoop, this, w);
+    }
+}
+
+void Scheduler::stopWorkers() {
+    {
+        lock_guard<mutex> guard(sleepLock);
+        stopping = true;
+        epoch++;
+    }
+    wakeUp.notify_all();
+    for (thread& worker : workers) {
+        worker.join();
+    }
+    workers.clear();
+}
+
+/**
+ * @brief Runs tasks until the scheduler stops, sleeping while there is
+ * nothing to run or steal
+ *
+ * @param index
+ */
+void Scheduler::workerLoop(int index) {
+    currentScheduler = this;
+    currentWorker = index;
+
+    while (!stopping) {
+        long long seen = epoch.load();
+        Task* task = findTask(index);
+        if (task) {
+            execute(task);
+            continue;
+        }
+
+        unique_lock<mutex> lock(sleepLock);
+        sleepers++;
+        while (epoch.load() == seen && !stopping) {
+            wakeUp.wait(lock);
+        }
+        sleepers--;
+    }
+}
+
+/**
+ * @brief Wakes the sleeping workers after new tasks were queued
+ *
+ */
+void Scheduler::notify() {
+    epoch++;
+    if (sleepers.load() > 0) {
+        { lock_guard<mutex> guard(sleepLock); }
+        wakeUp.notify_all();
+    }
+}
+
+/**
+ * @brief Queues a task on the deque of the calling worker, or on the
+ * shared queue when called from outside the pool
+ *
+ * @param task
+ */
+void Scheduler::submit(Task* task) {
+    if (currentScheduler == this) {
+        deques[currentWorker]->push(task);
+    } else {
+        lock_guard<mutex> guard(injectLock);
+        injected.push_back(task);
+        injectedCount++;
+    }
+    notify();
+}
+
+/**
+ * @brief Looks for a task: first the own deque, then the shared queue,
+ * then the deques of the other workers
+ *
+ * @param self: worker index, or -1 outside the pool
+ * @return Scheduler::Task*
+ */
+Scheduler::Task* Scheduler::findTask(int self) {
+    Task* task = nullptr;
+    if (self >= 0 && (task = deques[self]->pop())) {
+        return task;
+    }
+
+    if (injectedCount.load() > 0) {
+        lock_guard<mutex> guard(injectLock);
+        if (!injected.empty()) {
+            task = injected.front();
+            injected.pop_front();
+            injectedCount--;
+            return task;
+        }
+    }
+
+    int count = (int)deques.size();
+    for (int i = 1; i <= count; i++) {
+        int victim = (self + i + count) % count;
+        if (victim != self && (task = deques[victim]->steal())) {
+            return task;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Runs a range of iterations. While the range has more than one
+ * iteration, its upper half is split off and queued for other threads.
+ * The thread finishing the last iteration wakes the one waiting for the
+ * loop.
+ *
+ * @param task
+ */
+void Scheduler::execute(Task* task) {
+    Job* job = task->job;
+    int first = task->first;
+    int last = task->last;
+
+    while (last - first > 1) {
+        int middle = first + (last - first) / 2;
+        Task& half = job->tasks[middle];
+        half = Task{job, middle, last};
+        submit(&half);
+        last = middle;
+    }
+
+    (*job->body)(first);
+    // The job may be gone once pending reaches zero
+    if (job->pending.fetch_sub(1, memory_order_acq_rel) == 1) {
+        notify();
+    }
+}
+
+/**
+ * @brief Runs body(0) .. body(taskCount - 1) on the pool and returns once
+ * all of them are done. The calling thread runs or steals tasks while it
+ * waits, so loops can be nested inside tasks, and sleeps like an idle
+ * worker when there is nothing to take.
+ *
+ * @param taskCount
+ * @param body
+ */
+void Scheduler::parallelFor(int taskCount, const function<void(int)>& body) {
+    if (taskCount <= 0) {
+        return;
+    }
+
+    Job job;
+    job.body = &body;
+    job.pending = taskCount;
+    job.tasks.resize(taskCount);
+    job.tasks[0] = Task{&job, 0, taskCount};
+    int self = currentScheduler == this ? currentWorker : -1;
+
+    execute(&job.tasks[0]);
+    while (true) {
+        long long seen = epoch.load();
+        if (job.pending.load(memory_order_acquire) == 0) {
+            break;
+        }
+        Task* task = findTask(self);
+        if (task) {
+            execute(task);
+            continue;
+        }
+
+        unique_lock<mutex> lock(sleepLock);
+        sleepers++;
+        while (epoch.load() == seen && job.pending.load(memory_order_acquire) > 0) {
+            wakeUp.wait(lock);
+        }
+        sleepers--;
+    }
+}
@@ -0,0 +1,109 @@
+/**
+ * @file Scheduler.h
+ *
+ * @author agent
+ * @date 2026-10-17
+ *
+ * @brief Defines the class Scheduler, a work-stealing thread pool shared
+ * by every parallel loop in the program
+ */
+
+#ifndef GRAPH_APP_SCHEDULER_H
+#define GRAPH_APP_SCHEDULER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class Scheduler {
+	public:
+	/**	Constructors/Destructors */
+	Scheduler(int workerCount);
+	Scheduler(const Scheduler&) = delete;
+	Scheduler& operator=(const Scheduler&) = delete;
+	~Scheduler();
+
+	/** The scheduler used by parallelFor */
+	static Scheduler& global();
+
+	/** Worker methods. The worker count must not change while tasks run. */
+	void setWorkerCount(int workerCount);
+	int getWorkerCount() const { return (int)workers.size(); };
+
+	/** Fork-join methods */
+	void parallelFor(int taskCount, const std::function<void(int)>& body);
+
+	private:
+	struct Job;
+
+	/** A range of iterations of a job; split in halves as it runs */
+	struct Task {
+		Job* job;
+		int first, last;
+	};
+
+	/**
+	 * A parallel loop waiting for its iterations to finish. Every split
+	 * starts a range at a different iteration, so the tasks are stored
+	 * by their first iteration and need no allocation of their own.
+	 */
+	struct Job {
+		const std::function<void(int)>* body;
+		std::atomic<int> pending;
+		std::vector<Task> tasks;
+	};
+
+	/**
+	 * Chase-Lev deque: the owner pushes and pops at the bottom, thieves
+	 * steal from the top. Grown arrays are kept until the deque is
+	 * destroyed, so a thief never reads freed memory.
+	 */
+	class TaskDeque {
+		public:
+		TaskDeque();
+		void push(Task* task);
+		Task* pop();
+		Task* steal();
+
+		private:
+		struct Array {
+			Array(long long capacity) : mask{capacity - 1}, slots(capacity) {};
+			long long mask;
+			std::vector<std::atomic<Task*>> slots;
+		};
+
+		std::atomic<long long> top, bottom;
+		std::atomic<Array*> array;
+		std::vector<std::unique_ptr<Array>> arrays;
+	};
+
+	std::vector<std::unique_ptr<TaskDeque>> deques;
+	std::vector<std::thread> workers;
+
+	/** Tasks submitted by threads that are not workers */
+	std::mutex injectLock;
+	std::deque<Task*> injected;
+	std::atomic<int> injectedCount;
+
+	/** Idle workers sleep until the epoch changes */
+	std::mutex sleepLock;
+	std::condition_variable wakeUp;
+	std::atomic<long long> epoch;
+	std::atomic<int> sleepers;
+	std::atomic<bool> stopping;
+
+	void workerLoop(int index);
+	void submit(Task* task);
+	void notify();
+	Task* findTask(int self);
+	void execute(Task* task);
+	void startWorkers(int workerCount);
+	void stopWorkers();
+};
+
+#endif //GRAPH_APP_SCHEDULER_H
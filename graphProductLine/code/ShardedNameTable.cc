@@ -0,0 +1,134 @@
+/**
+ * @file ShardedNameTable.cc
+ *
+ * @author agent
+ * @date 2026-10-17
+ *
+ * @brief Defines the class ShardedNameTable, a concurrent name table split
+ * into independently locked open-addressing shards, used to intern node
+ * names from several loader threads
+ */
+
+#include "ShardedNameTable.h"
+#include "NameIndex.h"
+#include "Parallel.h"
+
+using namespace std;
+
+/**
+ * @brief Construct a new ShardedNameTable:: ShardedNameTable object
+ *
+ * @param shardBits: the table has 2^shardBits shards
+ */
+ShardedNameTable::ShardedNameTable(int shardBits) : shardBits{shardBits}, shardMask{(1 << shardBits) - 1} {
+    for (int s = 0; s <= shardMask; s++) {
+        shards.emplace_back(new Shard());
+        shards.back()->slots.assign(16, -1);
+        shards.back()->mask = 15;
+    }
+}
+
+/**
+ * @brief Destroy the ShardedNameTable:: ShardedNameTable object
+ *
+ */
+ShardedNameTable::~ShardedNameTable() {
+
+}
+
+/**
+ * @brief Doubles the slot array of a shard
+ *
+ * @param shard
+ */
+void ShardedNameTable::grow(Shard& shard) {
+    shard.slots.assign(shard.slots.size() * 2, -1);
+    shard.mask = shard.slots.size() - 1;
+    for (size_t i = 0; i < shard.entries.size(); i++) {
+        size_t slot = (shard.entries[i].hash >> 16) & shard.mask;
+        while (shard.slots[slot] != -1) {
+            slot = (slot + 1) & shard.mask;
+        }
+        shard.slots[slot] = (int)i;
+    }
+}
+
+/**
+ * @brief Returns a handle for the name, adding it if needed, and keeps
+ * the smallest position the name was seen at. The name must stay valid
+ * for the lifetime of the table.
+ *
+ * @param name
+ * @param position: byte offset of the name in the input
+ * @return int
+ */
+int ShardedNameTable::intern(string_view name, uint64_t position) {
+    uint64_t hash = NameIndex::hash(name);
+    int shardIndex = (int)(hash & shardMask);
+    Shard& shard = *shards[shardIndex];
+
+    lock_guard<mutex> guard(shard.lock);
+    size_t slot = (hash >> 16) & shard.mask;
+    while (shard.slots[slot] != -1) {
+        Entry& entry = shard.entries[shard.slots[slot]];
+        if (entry.hash == hash && entry.name == name) {
+            if (position < entry.firstPosition) {
+                entry.firstPosition = position;
+            }
+            return (shard.slots[slot] << shardBits) | shardIndex;
+        }
+        slot = (slot + 1) & shard.mask;
+    }
+
+    int local = (int)shard.entries.size();
+    shard.entries.push_back(Entry{hash, name, position, -1});
+    shard.slots[slot] = local;
+    if (shard.entries.size() * 2 > shard.slots.size()) {
+        grow(shard);
+    }
+    return (local << shardBits) | shardIndex;
+}
+
+/**
+ * @brief Numbers the names in the order they first appear in the input,
+ * which matches the IDs a sequential load would assign
+ *
+ * @param threadCount
+ * @return int: number of names
+ */
+int ShardedNameTable::assignIDs(int threadCount) {
+    vector<pair<uint64_t, int>> order;
+    for (int s = 0; s <= shardMask; s++) {
+        for (size_t i = 0; i < shards[s]->entries.size(); i++) {
+            order.emplace_back(shards[s]->entries[i].firstPosition, ((int)i << shardBits) | s);
+        }
+    }
+
+    parallelSort(order, [](const pair<uint64_t, int>& a, const pair<uint64_t, int>& b) {
+        return a.first < b.first;
+    }, threadCount);
+
+    for (size_t id = 0; id < order.size(); id++) {
+        int handle = order[id].second;
+        shards[handle & shardMask]->entries[handle >> shardBits].id = (int)id;
+    }
+    return (int)order.size();
+}
+
+/**
+ * @brief Lists the names by ID, after assignIDs
+ *
+ * @param names
+ */
+void ShardedNameTable::namesByID(vector<string_view>& names) const {
+    size_t count = 0;
+    for (auto& shard : shards) {
+        count += shard->entries.size();
+    }
+    names.resize(count);
+    for (auto& shard : shards) {
+        for (const Entry& entry : shard->entries) {
+            names[entry.id] = entry.name;
+        }
+    }
+}
@@ -0,0 +1,59 @@
+/**
+ * @file ShardedNameTable.h
+ *
+ * @author agent
+ * @date 2026-10-17
+ *
+ * @brief Defines the class ShardedNameTable, a concurrent name table split
+ * into independently locked open-addressing shards, used to intern node
+ * names from several loader threads
+ */
+
+#ifndef GRAPH_APP_SHARDEDNAMETABLE_H
+#define GRAPH_APP_SHARDEDNAMETABLE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+class ShardedNameTable {
+	public:
+	/**	Constructors/Destructors */
+	ShardedNameTable(int shardBits = 8);
+	~ShardedNameTable();
+
+	/** Interning methods, safe to call from several threads */
+	int intern(std::string_view name, uint64_t position);
+
+	/** Methods used once all threads are done interning */
+	int assignIDs(int threadCount);
+	int idOf(int handle) const { return shards[handle & shardMask]->entries[handle >> shardBits].id; };
+	void namesByID(std::vector<std::string_view>& names) const;
+
+	private:
+	/** A name and the file position where it first appears */
+	struct Entry {
+		uint64_t hash;
+		std::string_view name;
+		uint64_t firstPosition;
+		int id;
+	};
+
+	struct Shard {
+		std::mutex lock;
+		std::vector<int> slots;
+		std::vector<Entry> entries;
+		size_t mask;
+	};
+
+	std::vector<std::unique_ptr<Shard>> shards;
+	int shardBits;
+	int shardMask;
+
+	static void grow(Shard& shard);
+};
+
+#endif //GRAPH_APP_SHARDEDNAMETABLE_H
@@ -0,0 +1,270 @@
+/**
+ * @file ShortestPath.cc
+ *
+ * @author agent
+ * @date 2026-10-17
+ *
+ * @brief Defines the class ShortestPath, which answers shortest path
+ * queries on a frozen graph with Dijkstra's algorithm, its bidirectional
+ * variant, or BFS for unweighted graphs
+ */
+
+#include "ShortestPath.h"
+#include "Stats.h"
+#include <algorithm>
+
+using namespace std;
+
+/**
+ * @brief Construct a new ShortestPath:: ShortestPath object
+ *
+ */
+ShortestPath::ShortestPath() : source{-1}, target{-1}, meeting{-1} {
+
+}
+
+/**
+ * @brief Destroy the ShortestPath:: ShortestPath object
+ *
+ */
+ShortestPath::~ShortestPath() {
+
+}
+
+/**
+ * @brief Prepares the workspace for a new query. Arrays only grow, and
+ * clearing the reached set is O(1).
+ *
+ * @param nodeCount
+ */
+void ShortestPath::Workspace::reset(int nodeCount) {
+    if ((int)dist.size() < nodeCount) {
+        dist.resize(nodeCount);
+        parent.resize(nodeCount);
+    }
+    reached.resize(nodeCount);
+    reached.clear();
+    heap.clear();
+    queue.clear();
+}
+
+/**
+ * @brief Records a tentative distance if it improves the current one
+ *
+ * @param nodeID
+ * @param parentID
+ * @param newDist
+ * @return true if the distance improved
+ * @return false otherwise
+ */
+bool ShortestPath::Workspace::relax(int nodeID, int parentID, uint64_t newDist) {
+    if (reached.test(nodeID) && dist[nodeID] <= newDist) {
+        return false;
+    }
+    reached.set(nodeID);
+    dist[nodeID] = newDist;
+    parent[nodeID] = parentID;
+    return true;
+}
+
+/**
+ * @brief Single-source Dijkstra on a radix heap. Stops as soon as the
+ * target is settled, or explores the whole graph if target is -1.
+ * Edge weights must be non-negative.
+ *
+ * @param graph
+ * @param source
+ * @param target
+ * @return long long
+ */
+long long ShortestPath::dijkstra(const CSRGraph& graph, int source, int target) {
+    this->source = source;
+    this->target = target;
+    meeting = target;
+
+    Workspace& side = forwardSide;
+    side.reset(graph.getNodeCount());
+    side.relax(source, -1, 0);
+    side.heap.push(0, source);
+
+    while (!side.heap.empty()) {
+        pair<uint64_t, int> entry = side.heap.pop();
+        int u = entry.second;
+        if (entry.first > side.dist[u]) {
+            continue;
+        }
+        if (u == target) {
+            return (long long)entry.first;
+        }
+        STAT_ADD(nodesVisited, 1);
+        STAT_ADD(edgesVisited, graph.degree(u));
+
+        for (int slot = graph.offsets[u]; slot < graph.offsets[u + 1]; slot++) {
+            int v = graph.targets[slot];
+            uint64_t newDist = entry.first + (graph.isWeighted() ? graph.weights[slot] : 1);
+            if (side.relax(v, u, newDist)) {
+                side.heap.push(newDist, v);
+            }
+        }
+    }
+
+    return target == -1 ? 0 : UNREACHABLE;
+}
+
+/**
+ * @brief Settles the closest node of one side of a bidirectional search
+ * and updates the best meeting distance found so far
+ *
+ * @param side
+ * @param graph: adjacency in the direction of this side
+ * @param other
+ * @param best: length of the best source-target path seen so far
+ */
+void ShortestPath::settle(Workspace& side, const CSRGraph& graph, Workspace& other, uint64_t& best) {
+    pair<uint64_t, int> entry = side.heap.pop();
+    int u = entry.second;
+    if (entry.first > side.dist[u]) {
+        return;
+    }
+    STAT_ADD(nodesVisited, 1);
+    STAT_ADD(edgesVisited, graph.degree(u));
+
+    for (int slot = graph.offsets[u]; slot < graph.offsets[u + 1]; slot++) {
+        int v = graph.targets[slot];
+        uint64_t newDist = entry.first + (graph.isWeighted() ? graph.weights[slot] : 1);
+        if (side.relax(v, u, newDist)) {
+            side.heap.push(newDist, v);
+        }
+        if (other.reached.test(v) && newDist + other.dist[v] < best) {
+            best = newDist + other.dist[v];
+            meeting = v;
+        }
+    }
+}
+
+/**
+ * @brief Single-pair Dijkstra that grows one search from the source on the
+ * forward graph and one from the target on the backward graph, always
+ * advancing the side with the smaller frontier key. Stops when the two
+ * frontier keys add up to the best meeting distance.
+ *
+ * @param forward
+ * @param backward: the transposed graph (the graph itself if undirected)
+ * @param source
+ * @param target
+ * @return long long
+ */
+long long ShortestPath::bidirectional(const CSRGraph& forward, const CSRGraph& backward, int source, int target) {
+    this->source = source;
+    this->target = target;
+    meeting = -1;
+
+    forwardSide.reset(forward.getNodeCount());
+    backwardSide.reset(backward.getNodeCount());
+    forwardSide.relax(source, -1, 0);
+    forwardSide.heap.push(0, source);
+    backwardSide.relax(target, -1, 0);
+    backwardSide.heap.push(0, target);
+
+    uint64_t best = UINT64_MAX;
+    if (source == target) {
+        best = 0;
+        meeting = source;
+    }
+
+    while (!forwardSide.heap.empty() && !backwardSide.heap.empty()) {
+        uint64_t forwardKey = forwardSide.heap.topKey();
+        uint64_t backwardKey = backwardSide.heap.topKey();
+        if (best != UINT64_MAX && forwardKey + backwardKey >= best) {
+            break;
+        }
+
+        if (forwardKey <= backwardKey) {
+            settle(forwardSide, forward, backwardSide, best);
+        } else {
+            settle(backwardSide, backward, forwardSide, best);
+        }
+    }
+
+    return meeting == -1 ? UNREACHABLE : (long long)best;
+}
+
+/**
+ * @brief Breadth-first shortest path for unweighted graphs. Stops as soon
+ * as the target is discovered, or explores the whole graph if target is -1.
+ *
+ * @param graph
+ * @param source
+ * @param target
+ * @return long long
+ */
+long long ShortestPath::BFS(const CSRGraph& graph, int source, int target) {
+    this->source = source;
+    this->target = target;
+    meeting = target;
+
+    Workspace& side = forwardSide;
+    side.reset(graph.getNodeCount());
+    side.relax(source, -1, 0);
+    side.queue.push_back(source);
+
+    if (source == target) {
+        return 0;
+    }
+
+    for (size_t head = 0; head < side.queue.size(); head++) {
+        int u = side.queue[head];
+        STAT_ADD(nodesVisited, 1);
+        STAT_ADD(edgesVisited, graph.degree(u));
+        for (int slot = graph.offsets[u]; slot < graph.offsets[u + 1]; slot++) {
+            int v = graph.targets[slot];
+            if (!side.reached.test(v)) {
+                side.relax(v, u, side.dist[u] + 1);
+                if (v == target) {
+                    return (long long)side.dist[v];
+                }
+                side.queue.push_back(v);
+            }
+        }
+    }
+
+    return target == -1 ? 0 : UNREACHABLE;
+}
+
+/**
+ * @brief Distance from the source of the last single-direction query
+ *
+ * @param nodeID
+ * @return long long
+ */
+long long ShortestPath::distance(int nodeID) const {
+    if (!forwardSide.reached.test(nodeID)) {
+        return UNREACHABLE;
+    }
+    return (long long)forwardSide.dist[nodeID];
+}
+
+/**
+ * @brief Nodes on the path found by the last query, from source to target
+ *
+ * @return std::vector<int>
+ */
+vector<int> ShortestPath::path() const {
+    vector<int> nodes;
+    if (meeting == -1 || !forwardSide.reached.test(meeting)) {
+        return nodes;
+    }
+
+    for (int u = meeting; u != -1; u = forwardSide.parent[u]) {
+        nodes.push_back(u);
+    }
+    reverse(nodes.begin(), nodes.end());
+
+    // Second half of a bidirectional search, from the meeting node to the target
+    if (meeting != target) {
+        for (int u = backwardSide.parent[meeting]; u != -1; u = backwardSide.parent[u]) {
+            nodes.push_back(u);
+        }
+    }
+    return nodes;
+}
@@ -0,0 +1,58 @@
+/**
+ * @file ShortestPath.h
+ *
+ * @author agent
+ * @date 2026-10-17
+ *
+ * @brief Defines the class ShortestPath, which answers shortest path
+ * queries on a frozen graph with Dijkstra's algorithm, its bidirectional
+ * variant, or BFS for unweighted graphs
+ */
+
+#ifndef GRAPH_APP_SHORTESTPATH_H
+#define GRAPH_APP_SHORTESTPATH_H
+
+#include "CSRGraph.h"
+#include "RadixHeap.h"
+#include "VisitedSet.h"
+#include <cstdint>
+#include <vector>
+
+class ShortestPath {
+	public:
+	/**	Constructors/Destructors */
+	ShortestPath();
+	~ShortestPath();
+
+	/** Query methods, returning the distance or UNREACHABLE */
+	long long dijkstra(const CSRGraph& graph, int source, int target = -1);
+	long long bidirectional(const CSRGraph& forward, const CSRGraph& backward, int source, int target);
+	long long BFS(const CSRGraph& graph, int source, int target = -1);
+
+	/** Accessor methods for the results of the last query */
+	long long distance(int nodeID) const;
+	std::vector<int> path() const;
+
+	static constexpr long long UNREACHABLE = -1;
+
+	private:
+	/** Distances and parents of one search direction. Entries are only
+	 *  valid for nodes in reached, so a query never clears O(V) memory. */
+	struct Workspace {
+		std::vector<uint64_t> dist;
+		std::vector<int> parent;
+		VisitedSet reached;
+		RadixHeap heap;
+		std::vector<int> queue;
+
+		void reset(int nodeCount);
+		bool relax(int nodeID, int parentID, uint64_t newDist);
+	};
+
+	Workspace forwardSide, backwardSide;
+	int source, target, meeting;
+
+	void settle(Workspace& side, const CSRGraph& graph, Workspace& other, uint64_t& best);
+};
+
+#endif //GRAPH_APP_SHORTESTPATH_H
@@ -0,0 +1,181 @@
+/**
+ * @file Stats.cc
+ *
+ * @author agent
+ * @date 2026-10-17
+ *
+ * @brief Defines the instrumentation counters of the graph algorithms and
+ * the class CommandStats, which sums them up per command. Building with
+ * GRAPH_STATS=0 removes the counters from the hot paths.
+ */
+
+#include "Stats.h"
+#include <algorithm>
+#include <fstream>
+#include <sys/resource.h>
+
+using namespace std;
+
+/** Static variables */
+StatCounters statCounters;
+
+/**
+ * @brief Returns a copy of the counters
+ *
+ * @return StatCounters
+ */
+StatCounters currentCounters() {
+    return statCounters;
+}
+
+/**
+ * @brief Returns the peak resident memory of the process
+ *
+ * @return long
+ */
+long peakMemoryKB() {
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0;
+    }
+    return usage.ru_maxrss;
+}
+
+/**
+ * @brief Remembers the counters at the start of a command
+ *
+ */
+void CommandStats::begin() {
+    start = currentCounters();
+}
+
+/**
+ * @brief Adds the work done since begin() to the totals of a command
+ *
+ * @param command
+ * @param milliseconds: wall time of the command
+ */
+void CommandStats::end(const string& command, double milliseconds) {
+    StatCounters now = currentCounters();
+    Entry& entry = entries[command];
+    entry.calls++;
+    entry.totalMilliseconds += milliseconds;
+    entry.maxMilliseconds = max(entry.maxMilliseconds, milliseconds);
+    entry.counters.nodesVisited += now.nodesVisited - start.nodesVisited;
+    entry.counters.edgesVisited += now.edgesVisited - start.edgesVisited;
+    entry.counters.heapPushes += now.heapPushes - start.heapPushes;
+    entry.counters.heapPops += now.heapPops - start.heapPops;
+    entry.counters.allocations += now.allocations - start.allocations;
+    entry.counters.allocatedBytes += now.allocatedBytes - start.allocatedBytes;
+}
+
+/**
+ * @brief Prints one line per command that has run
+ *
+ * @param out
+ */
+void CommandStats::print(ostream& out) const {
+    if (entries.empty()) {
+        out << "No commands recorded" << '\n';
+    }
+    for (auto& item : entries) {
+        const Entry& entry = item.second;
+        out << item.first << ": " << entry.calls << " calls, " << entry.totalMilliseconds << " ms total, " <<
+        entry.maxMilliseconds << " ms max, " << entry.counters.nodesVisited << " nodes, " <<
+        entry.counters.edgesVisited << " edges, " << entry.counters.heapPushes << " heap pushes, " <<
+        entry.counters.heapPops << " heap pops, " << entry.counters.allocations << " allocations (" <<
+        entry.counters.allocatedBytes << " bytes)" << '\n';
+    }
+    out << "Peak memory: " << peakMemoryKB() << " KB" << '\n';
+}
+
+/**
+ * @brief Writes the totals as a JSON object keyed by command
+ *
+ * @param out
+ */
+void CommandStats::writeJSON(ostream& out) const {
+    out << "{\n  \"peak_memory_kb\": " << peakMemoryKB() << ",\n  \"commands\": {";
+    bool first = true;
+    for (auto& item : entries) {
+        const Entry& entry = item.second;
+        out << (first ? "\n" : ",\n") << "    \"" << item.first << "\": {\"calls\": " << entry.calls <<
+        ", \"total_ms\": " << entry.totalMilliseconds << ", \"max_ms\": " << entry.maxMilliseconds <<
+        ", \"nodes_visited\": " << entry.counters.nodesVisited <<
+        ", \"edges_visited\": " << entry.counters.edgesVisited <<
+        ", \"heap_pushes\": " << entry.counters.heapPushes << ", \"heap_pops\": " << entry.counters.heapPops <<
+        ", \"allocations\": " << entry.counters.allocations <<
+        ", \"allocated_bytes\": " << entry.counters.allocatedBytes << "}";
+        first = false;
+    }
+    out << "\n  }\n}\n";
+}
+
+/**
+ * @brief Writes the totals in the Prometheus text exposition format, with
+ * the command as a label
+ *
+ * @param out
+ */
+void CommandStats::writePrometheus(ostream& out) const {
+    struct Metric {
+        const char* name;
+        const char* help;
+        const char* type;
+    };
+    const Metric metrics[] = {
+        {"graphapp_command_calls_total", "Commands run", "counter"},
+        {"graphapp_command_seconds_total", "Wall time spent in commands", "counter"},
+        {"graphapp_command_seconds_max", "Slowest run of a command", "gauge"},
+        {"graphapp_nodes_visited_total", "Nodes visited by the algorithms", "counter"},
+        {"graphapp_edges_visited_total", "Edges visited by the algorithms", "counter"},
+        {"graphapp_heap_pushes_total", "Priority queue insertions and decrease-keys", "counter"},
+        {"graphapp_heap_pops_total", "Priority queue removals", "counter"},
+        {"graphapp_allocations_total", "Node and edge slabs and CSR arrays allocated", "counter"},
+        {"graphapp_allocated_bytes_total", "Bytes of node and edge slabs and CSR arrays", "counter"}
+    };
+
+    for (int m = 0; m < (int)(sizeof(metrics) / sizeof(metrics[0])); m++) {
+        out << "# HELP " << metrics[m].name << " " << metrics[m].help << '\n' <<
+        "# TYPE " << metrics[m].name << " " << metrics[m].type << '\n';
+        for (auto& item : entries) {
+            const Entry& entry = item.second;
+            out << metrics[m].name << "{command=\"" << item.first << "\"} ";
+            switch (m) {
+                case 0: out << entry.calls; break;
+                case 1: out << entry.totalMilliseconds / 1000; break;
+                case 2: out << entry.maxMilliseconds / 1000; break;
+                case 3: out << entry.counters.nodesVisited; break;
+                case 4: out << entry.counters.edgesVisited; break;
+                case 5: out << entry.counters.heapPushes; break;
+                case 6: out << entry.counters.heapPops; break;
+                case 7: out << entry.counters.allocations; break;
+                default: out << entry.counters.allocatedBytes; break;
+            }
+            out << '\n';
+        }
+    }
+    out << "# HELP graphapp_peak_memory_bytes Peak resident memory" << '\n' <<
+    "# TYPE graphapp_peak_memory_bytes gauge" << '\n' <<
+    "graphapp_peak_memory_bytes " << peakMemoryKB() * 1024 << '\n';
+}
+
+/**
+ * @brief Writes the totals to a file: Prometheus text if the name ends
+ * in .prom, JSON otherwise
+ *
+ * @param filename
+ * @return true
+ * @return false if the file could not be written
+ */
+bool CommandStats::save(const string& filename) const {
+    ofstream file(filename);
+    string extension = ".prom";
+    if (filename.size() >= extension.size() &&
+        filename.compare(filename.size() - extension.size(), extension.size(), extension) == 0) {
+        writePrometheus(file);
+    } else {
+        writeJSON(file);
+    }
+    return (bool)file;
+}
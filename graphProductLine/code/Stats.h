@@ -0,0 +1,75 @@
+/**
+ * @file Stats.h
+ *
+ * @author agent
+ * @date 2026-10-17
+ *
+ * @brief Defines the instrumentation counters of the graph algorithms and
+ * the class CommandStats, which sums them up per command. Building with
+ * GRAPH_STATS=0 removes the counters from the hot paths.
+ */
+
+#ifndef GRAPH_APP_STATS_H
+#define GRAPH_APP_STATS_H
+
+#ifndef GRAPH_STATS
+#define GRAPH_STATS 1
+#endif
+
+#include <cstdint>
+#include <map>
+#include <ostream>
+#include <string>
+
+/**
+ * Work done by the algorithms. Traversal counters are updated by the
+ * serial kernels; parallel engines add their totals when they finish.
+ * Allocations count the node and edge slabs and the CSR arrays, the
+ * memory that grows with the graph.
+ */
+struct StatCounters {
+	uint64_t nodesVisited = 0;
+	uint64_t edgesVisited = 0;
+	uint64_t heapPushes = 0;
+	uint64_t heapPops = 0;
+	uint64_t allocations = 0;
+	uint64_t allocatedBytes = 0;
+};
+
+extern StatCounters statCounters;
+
+#if GRAPH_STATS
+#define STAT_ADD(counter, amount) (statCounters.counter += (amount))
+#else
+#define STAT_ADD(counter, amount) ((void)0)
+#endif
+
+StatCounters currentCounters();
+long peakMemoryKB();
+
+class CommandStats {
+	public:
+	/** Recording methods */
+	void begin();
+	void end(const std::string& command, double milliseconds);
+
+	/** Output methods */
+	void print(std::ostream& out) const;
+	void writeJSON(std::ostream& out) const;
+	void writePrometheus(std::ostream& out) const;
+	bool save(const std::string& filename) const;
+
+	private:
+	/** Totals of one command */
+	struct Entry {
+		uint64_t calls = 0;
+		double totalMilliseconds = 0;
+		double maxMilliseconds = 0;
+		StatCounters counters;
+	};
+
+	std::map<std::string, Entry> entries;
+	StatCounters start;
+};
+
+#endif //GRAPH_APP_STATS_H
@@ -0,0 +1,98 @@
+/**
+ * @file StronglyConnectedComps.cc
+ *
+ * @author agent
+ * @date 2026-10-17
+ *
+ * @brief Defines the class StronglyConnectedComps, which labels the strongly
+ * connected components of a directed graph with an iterative Tarjan search
+ */
+
+#include "StronglyConnectedComps.h"
+
+using namespace std;
+
+/**
+ * @brief Construct a new StronglyConnectedComps:: StronglyConnectedComps object
+ *
+ */
+StronglyConnectedComps::StronglyConnectedComps() : componentCount{0} {
+
+}
+
+/**
+ * @brief Destroy the StronglyConnectedComps:: StronglyConnectedComps object
+ *
+ */
+StronglyConnectedComps::~StronglyConnectedComps() {
+
+}
+
+/**
+ * @brief Runs Tarjan's algorithm in O(V+E) with an explicit call stack.
+ * Afterwards components[u] holds the component of node u. Components are
+ * numbered in the order they are completed, which is a reverse
+ * topological order of the condensation.
+ *
+ * @param graph
+ * @return int
+ */
+int StronglyConnectedComps::compute(const CSRGraph& graph) {
+    int nodeCount = graph.getNodeCount();
+    components.assign(nodeCount, -1);
+    index.assign(nodeCount, -1);
+    lowlink.resize(nodeCount);
+    stack.clear();
+    frames.clear();
+    componentCount = 0;
+
+    int counter = 0;
+    for (int root = 0; root < nodeCount; root++) {
+        if (index[root] != -1) {
+            continue;
+        }
+
+        index[root] = lowlink[root] = counter++;
+        stack.push_back(root);
+        frames.push_back(Frame{root, graph.offsets[root]});
+
+        while (!frames.empty()) {
+            Frame& frame = frames.back();
+            int u = frame.nodeID;
+
+            if (frame.slot < graph.offsets[u + 1]) {
+                int v = graph.targets[frame.slot++];
+                if (index[v] == -1) {
+                    index[v] = lowlink[v] = counter++;
+                    stack.push_back(v);
+                    frames.push_back(Frame{v, graph.offsets[v]});
+                } else if (components[v] == -1 && index[v] < lowlink[u]) {
+                    // v is still on the Tarjan stack
+                    lowlink[u] = index[v];
+                }
+                continue;
+            }
+
+            // u is finished: pop its component if it is the root of one
+            frames.pop_back();
+            if (lowlink[u] == index[u]) {
+                int v;
+                do {
+                    v = stack.back();
+                    stack.pop_back();
+                    components[v] = componentCount;
+                } while (v != u);
+                componentCount++;
+            }
+
+            if (!frames.empty()) {
+                int parent = frames.back().nodeID;
+                if (lowlink[u] < lowlink[parent]) {
+                    lowlink[parent] = lowlink[u];
+                }
+            }
+        }
+    }
+
+    return componentCount;
+}
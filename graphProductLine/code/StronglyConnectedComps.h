@@ -0,0 +1,45 @@
+/**
+ * @file StronglyConnectedComps.h
+ *
+ * @author agent
+ * @date 2026-10-17
+ *
+ * @brief Defines the class StronglyConnectedComps, which labels the strongly
+ * connected components of a directed graph with an iterative Tarjan search
+ */
+
+#ifndef GRAPH_APP_STRONGLYCONNECTEDCOMPS_H
+#define GRAPH_APP_STRONGLYCONNECTEDCOMPS_H
+
+#include "CSRGraph.h"
+#include <vector>
+
+class StronglyConnectedComps {
+	public:
+	/**	Constructors/Destructors */
+	StronglyConnectedComps();
+	~StronglyConnectedComps();
+
+	/** Computes the components, returning how many there are */
+	int compute(const CSRGraph& graph);
+
+	/** Accessor methods for the result of the last computation */
+	int getComponentCount() const { return componentCount; };
+	const std::vector<int>& getComponents() const { return components; };
+
+	private:
+	/** Tarjan call frame: node and next adjacency slot to explore */
+	struct Frame {
+		int nodeID;
+		int slot;
+	};
+
+	std::vector<int> components;
+	std::vector<int> index;
+	std::vector<int> lowlink;
+	std::vector<int> stack;
+	std::vector<Frame> frames;
+	int componentCount;
+};
+
+#endif //GRAPH_APP_STRONGLYCONNECTEDCOMPS_H
@@ -0,0 +1,55 @@
+/**
+ * @file VisitedSet.cc
+ *
+ * @author agent
+ * @date 2026-10-17
+ *
+ * @brief Defines the class VisitedSet, a dense set of node IDs that can
+ * be cleared in constant time
+ */
+
+#include "VisitedSet.h"
+#include <algorithm>
+
+using namespace std;
+
+/**
+ * @brief Construct a new VisitedSet:: VisitedSet object
+ *
+ */
+VisitedSet::VisitedSet() : epoch{1} {
+
+}
+
+/**
+ * @brief Destroy the VisitedSet:: VisitedSet object
+ *
+ */
+VisitedSet::~VisitedSet() {
+
+}
+
+/**
+ * @brief Makes room for node IDs up to nodeCount - 1. New IDs start
+ * outside the set.
+ *
+ * @param nodeCount
+ */
+void VisitedSet::resize(size_t nodeCount) {
+    if (nodeCount > stamps.size()) {
+        stamps.resize(nodeCount, 0);
+    }
+}
+
+/**
+ * @brief Empties the set by starting a new epoch. The stamps are only
+ * rewritten when the epoch counter wraps around.
+ *
+ */
+void VisitedSet::clear() {
+    epoch++;
+    if (epoch == 0) {
+        fill(stamps.begin(), stamps.end(), 0);
+        epoch = 1;
+    }
+}
@@ -0,0 +1,40 @@
+/**
+ * @file VisitedSet.h
+ *
+ * @author agent
+ * @date 2026-10-17
+ *
+ * @brief Defines the class VisitedSet, a dense set of node IDs that can
+ * be cleared in constant time
+ */
+
+#ifndef GRAPH_APP_VISITEDSET_H
+#define GRAPH_APP_VISITEDSET_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class VisitedSet {
+	public:
+	/**	Constructors/Destructors */
+	VisitedSet();
+	~VisitedSet();
+
+	/** Accessor methods */
+	bool test(int id) const { return stamps[id] == epoch; };
+	size_t size() const { return stamps.size(); };
+
+	/** Mutator methods */
+	void set(int id) { stamps[id] = epoch; };
+	void reset(int id) { stamps[id] = 0; };
+	void resize(size_t nodeCount);
+	void clear();
+
+	private:
+	// A node is in the set when its stamp equals the current epoch
+	std::vector<uint32_t> stamps;
+	uint32_t epoch;
+};
+
+#endif //GRAPH_APP_VISITEDSET_H
@@ -0,0 +1,307 @@
+/**
+ * @file bench.cc
+ *
+ * @author agent
+ * @date 2026-10-17
+ *
+ * @brief Benchmark driver: generates synthetic graphs, times loading and
+ * the graph algorithms for several sizes and thread counts, and writes
+ * the results as JSON
+ */
+
+#include "GraphApp.h"
+#include "GraphGenerator.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+
+using namespace std;
+
+/**
+ * A timed command and the operation name it is reported under
+ */
+struct BenchCommand {
+    string operation;
+    string line;
+};
+
+/**
+ * Graph features of one benchmark run and the commands timed on it
+ */
+struct BenchVariant {
+    string name;
+    bool weighted;
+    bool directed;
+    vector<BenchCommand> commands;
+};
+
+/**
+ * Timings of one operation, in milliseconds
+ */
+struct BenchResult {
+    string generator;
+    string variant;
+    int nodeCount;
+    long long edgeCount;
+    int threadCount;
+    string operation;
+    vector<double> samples;
+};
+
+/**
+ * @brief Prints the command line options
+ *
+ * @param program: name the program was started with
+ */
+void printUsage(const char* program) {
+    cerr << "Usage: " << program << " [options]" << '\n' <<
+    "  --generators LIST  comma separated: er, rmat, grid, chain (default all)" << '\n' <<
+    "  --nodes LIST       comma separated graph sizes (default 16384,131072)" << '\n' <<
+    "  --threads LIST     comma separated thread counts (default 1 and all hardware threads)" << '\n' <<
+    "  --repeat N         runs of every operation (default 3)" << '\n' <<
+    "  --seed N           generator seed (default 1)" << '\n' <<
+    "  --dir DIR          where the generated graphs are written (default /tmp)" << '\n' <<
+    "  --output FILE      JSON results (default: standard output)" << '\n' <<
+    "  --help             show this message" << '\n';
+}
+
+/**
+ * @brief Splits a comma separated list
+ *
+ * @param list
+ * @return vector<string>
+ */
+vector<string> splitList(const string& list) {
+    vector<string> items;
+    stringstream stream(list);
+    string item;
+    while (getline(stream, item, ',')) {
+        if (!item.empty()) {
+            items.push_back(item);
+        }
+    }
+    return items;
+}
+
+/**
+ * @brief Parses a comma separated list of positive numbers
+ *
+ * @param list
+ * @param numbers
+ * @return true
+ * @return false if an item is not a positive number
+ */
+bool parseNumbers(const string& list, vector<int>& numbers) {
+    numbers.clear();
+    for (const string& item : splitList(list)) {
+        int number = atoi(item.c_str());
+        if (number <= 0) {
+            return false;
+        }
+        numbers.push_back(number);
+    }
+    return !numbers.empty();
+}
+
+/**
+ * @brief Writes a feature configuration with every algorithm enabled
+ *
+ * @param filename
+ * @param variant
+ * @return true
+ * @return false if the file could not be written
+ */
+bool writeConfig(const string& filename, const BenchVariant& variant) {
+    ofstream config(filename);
+    config << "kWeighted " << variant.weighted << '\n' <<
+    "kDirected " << variant.directed << '\n' <<
+    "kUndirected " << !variant.directed << '\n' <<
+    "kSearch 1\nkBFS 1\nkDFS 1\nkCycle 1\nkConnectedComps 1\nkStronglyConnectedComps 1\n" <<
+    "kPrim 1\nkKruskal 1\nkShortestPath 1\nkCSR 1\n";
+    return (bool)config;
+}
+
+/**
+ * @brief Returns the milliseconds elapsed since start
+ *
+ * @param start
+ * @return double
+ */
+double elapsed(chrono::steady_clock::time_point start) {
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+/**
+ * @brief Writes the results as a JSON object with one record per operation
+ *
+ * @param json
+ * @param results
+ * @param seed
+ */
+void writeJSON(ostream& json, const vector<BenchResult>& results, unsigned long long seed) {
+    json << "{\n  \"seed\": " << seed << ",\n  \"hardware_threads\": " << defaultThreadCount() <<
+    ",\n  \"results\": [";
+
+    for (size_t i = 0; i < results.size(); i++) {
+        const BenchResult& result = results[i];
+        vector<double> sorted = result.samples;
+        sort(sorted.begin(), sorted.end());
+
+        json << (i == 0 ? "\n" : ",\n") << "    {\"generator\": \"" << result.generator <<
+        "\", \"variant\": \"" << result.variant << "\", \"nodes\": " << result.nodeCount <<
+        ", \"edges\": " << result.edgeCount << ", \"threads\": " << result.threadCount <<
+        ", \"operation\": \"" << result.operation << "\", \"runs\": " << sorted.size() <<
+        ", \"min_ms\": " << sorted.front() << ", \"median_ms\": " << sorted[sorted.size() / 2] <<
+        ", \"max_ms\": " << sorted.back() << "}";
+    }
+    json << "\n  ]\n}\n";
+}
+
+/**
+ * Main point of entry for the
+ * benchmarks.
+ * @return Program return code.
+ */
+int main(int argc, char* argv[]) {
+    vector<string> generators = {"er", "rmat", "grid", "chain"};
+    vector<int> sizes = {16384, 131072};
+    vector<int> threadCounts = {1, defaultThreadCount()};
+    int repeat = 3;
+    unsigned long long seed = 1;
+    string directory = "/tmp";
+    string outputFilename;
+
+    for (int i = 1; i < argc; i++) {
+        string option = argv[i];
+        bool hasValue = i + 1 < argc;
+
+        if (option == "--help") {
+            printUsage(argv[0]);
+            return 0;
+        } else if (option == "--generators" && hasValue) {
+            generators = splitList(argv[++i]);
+        } else if (option == "--nodes" && hasValue) {
+            if (!parseNumbers(argv[++i], sizes)) {
+                cerr << "Invalid node counts: " << argv[i] << '\n';
+                return 1;
+            }
+        } else if (option == "--threads" && hasValue) {
+            if (!parseNumbers(argv[++i], threadCounts)) {
+                cerr << "Invalid thread counts: " << argv[i] << '\n';
+                return 1;
+            }
+        } else if (option == "--repeat" && hasValue) {
+            repeat = atoi(argv[++i]);
+            if (repeat <= 0) {
+                cerr << "Invalid repeat count: " << argv[i] << '\n';
+                return 1;
+            }
+        } else if (option == "--seed" && hasValue) {
+            seed = strtoull(argv[++i], nullptr, 10);
+        } else if (option == "--dir" && hasValue) {
+            directory = argv[++i];
+        } else if (option == "--output" && hasValue) {
+            outputFilename = argv[++i];
+        } else {
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    sort(threadCounts.begin(), threadCounts.end());
+    threadCounts.erase(unique(threadCounts.begin(), threadCounts.end()), threadCounts.end());
+
+    vector<BenchResult> results;
+    for (const string& generator : generators) {
+        for (int size : sizes) {
+            GraphGenerator graph(seed);
+            if (!graph.generate(generator, size)) {
+                cerr << "Unknown generator: " << generator << '\n';
+                return 1;
+            }
+            string source = graph.firstNodeName();
+
+            vector<BenchVariant> variants = {
+                {"weighted-undirected", true, false, {
+                    {"cycle checking", "cycle checking"},
+                    {"connected components", "connected components"},
+                    {"prim", "prim"},
+                    {"kruskal", "kruskal"},
+                    {"breadth first search", "breadth first search " + source}}},
+                {"unweighted-directed", false, true, {
+                    {"cycle checking", "cycle checking"},
+                    {"strongly connected components", "strongly connected components"},
+                    {"breadth first search", "breadth first search " + source}}}
+            };
+
+            for (const BenchVariant& variant : variants) {
+                string prefix = directory + "/graphBench-" + generator + "-" + to_string(size) + "-" + variant.name;
+                AppOptions options;
+                options.configFilename = prefix + ".config";
+                options.graphFilename = prefix + ".in";
+                options.format = "text";
+                options.storage = "csr";
+                options.outputFilename = "/dev/null";
+                options.cacheResults = false;
+
+                if (!writeConfig(options.configFilename, variant) || !graph.write(options.graphFilename, variant.weighted)) {
+                    cerr << "Unable to write " << prefix << '\n';
+                    return 1;
+                }
+
+                for (int threadCount : threadCounts) {
+                    options.threadCount = threadCount;
+                    cerr << generator << " " << graph.getNodeCount() << " " << variant.name << " threads=" << threadCount << '\n';
+
+                    // Loading is timed on fresh instances; the last one
+                    // runs the commands
+                    BenchResult load{generator, variant.name, graph.getNodeCount(), graph.getEdgeCount(), threadCount, "load", {}};
+                    unique_ptr<GraphApp> app;
+                    for (int run = 0; run < repeat; run++) {
+                        app.reset();
+                        auto start = chrono::steady_clock::now();
+                        app.reset(new GraphApp(options));
+                        load.samples.push_back(elapsed(start));
+                    }
+                    results.push_back(load);
+
+                    // Every run computes its result again. The first run
+                    // also pays for freezing the graph; the median leaves
+                    // it out
+                    for (const BenchCommand& command : variant.commands) {
+                        BenchResult timed{generator, variant.name, graph.getNodeCount(), graph.getEdgeCount(), threadCount,
+                            command.operation, {}};
+                        for (int run = 0; run < repeat; run++) {
+                            app->resetDerivedState();
+                            auto start = chrono::steady_clock::now();
+                            app->runCommand(command.line);
+                            timed.samples.push_back(elapsed(start));
+                        }
+                        results.push_back(timed);
+                    }
+                }
+
+                remove(options.configFilename.c_str());
+                remove(options.graphFilename.c_str());
+            }
+        }
+    }
+
+    if (outputFilename.empty()) {
+        writeJSON(cout, results, seed);
+    } else {
+        ofstream json(outputFilename);
+        writeJSON(json, results, seed);
+        if (!json) {
+            cerr << "Unable to write " << outputFilename << '\n';
+            return 1;
+        }
+    }
+
+    return 0;
+}
@@ -9,12 +9,32 @@
  */
 
 #include "GraphApp.h"
+#include <cstdlib>
 #include <iostream>
 
 using namespace std;
 
-
-
+/**
+ * @brief Prints the command line options
+ * 
+ * @param program: name the program was started with
+ */
+void printUsage(const char* program) {
+    cerr << "Usage: " << program << " [options]" << '\n' <<
+    "  --graph FILE     graph to load (default graphWeighted.in)" << '\n' <<
+    "  --config FILE    feature configuration (default feature.config)" << '\n' <<
+    "  --format FORMAT  graph file format: auto, text or snapshot (default auto)" << '\n' <<
+    "  --verify         check every array of a snapshot before using it" << '\n' <<
+    "  --storage KIND   graph storage: csr or lists (default from the config)" << '\n' <<
+    "  --script FILE    run the commands in FILE without prompts; - reads stdin" << '\n' <<
+    "  --threads N      worker threads (default: all hardware threads)" << '\n' <<
+    "  --output FILE    write command output to FILE" << '\n' <<
+    "  --timing         report load and command times on stderr" << '\n' <<
+    "  --stats          report the graph size on stderr after loading" << '\n' <<
+    "  --stats-file FILE  write command statistics to FILE on exit (.prom: Prometheus, else JSON)" << '\n' <<
+    "  --no-cache       do not replay the output of read-only commands" << '\n' <<
+    "  --help           show this message" << '\n';
+}
 
 /**
  * Main point of entry for the
@@ -22,12 +42,68 @@ using namespace std;
  * class.
  * @return Program return code.
  */
-int main() {
+int main(int argc, char* argv[]) {
+    AppOptions options;
+    string scriptFilename;
+
+    for (int i = 1; i < argc; i++) {
+        string option = argv[i];
+        bool hasValue = i + 1 < argc;
+
+        if (option == "--timing") {
+            options.timing = true;
+        } else if (option == "--stats") {
+            options.stats = true;
+        } else if (option == "--verify") {
+            options.verifySnapshot = true;
+        } else if (option == "--no-cache") {
+            options.cacheResults = false;
+        } else if (option == "--help") {
+            printUsage(argv[0]);
+            return 0;
+        } else if (option == "--graph" && hasValue) {
+            options.graphFilename = argv[++i];
+        } else if (option == "--config" && hasValue) {
+            options.configFilename = argv[++i];
+        } else if (option == "--format" && hasValue) {
+            options.format = argv[++i];
+            if (options.format != "auto" && options.format != "text" && options.format != "snapshot") {
+                cerr << "Unknown format: " << options.format << '\n';
+                return 1;
+            }
+        } else if (option == "--storage" && hasValue) {
+            options.storage = argv[++i];
+            if (options.storage != "csr" && options.storage != "lists") {
+                cerr << "Unknown storage: " << options.storage << '\n';
+                return 1;
+            }
+        } else if (option == "--script" && hasValue) {
+            scriptFilename = argv[++i];
+        } else if (option == "--threads" && hasValue) {
+            options.threadCount = atoi(argv[++i]);
+            if (options.threadCount <= 0) {
+                cerr << "Invalid thread count: " << argv[i] << '\n';
+                return 1;
+            }
+        } else if (option == "--output" && hasValue) {
+            options.outputFilename = argv[++i];
+        } else if (option == "--stats-file" && hasValue) {
+            options.statsFilename = argv[++i];
+        } else {
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+
     //Prepare GraphApp.
-    GraphApp graphApp = GraphApp("feature.config", "graphWeighted.in");
+    GraphApp graphApp(options);
 
-    // //Run GraphApp.
-    graphApp.handleCommands();
+    //Run GraphApp.
+    if (!scriptFilename.empty()) {
+        graphApp.runScript(scriptFilename);
+    } else {
+        graphApp.handleCommands();
+    }
     
     return 0;
-}
\ No newline at end of file
+}